@@ -0,0 +1,170 @@
+/*
+	The fixed corpus of positions timed by "./tic-tac-toe corpus" in every
+	version, and the driver printing the results as CSV. A version includes
+	this file once and defines corpus_prepare, which loads a position (not
+	timed), and corpus_choose, which chooses the computer's move in it.
+	The times are read from the monotonic wall clock, so the version must
+	define _POSIX_C_SOURCE (199309L or later) before its first #include.
+*/
+
+#define NUM_OF_CORPUS_POSITIONS 12
+#define CORPUS_TRIALS 25
+
+/* Positions of the corpus benchmark, cells row by row, 'x' to move */
+static const char *corpus_positions[NUM_OF_CORPUS_POSITIONS] = {
+	"_________",
+	"x___o____",
+	"____x___o",
+	"o___x____",
+	"x_______o",
+	"_x__o____",
+	"xo__x___o",
+	"xx_oo____",
+	"x_o___o_x",
+	"xo_ox____",
+	"xoxo_____",
+	"ox_xo____"
+};
+
+/* Cells (bit 3*row + col) of the moves keeping the best outcome in each corpus position */
+static const int corpus_best_moves[NUM_OF_CORPUS_POSITIONS] = {
+	0x1ff, 0x1ee, 0x0ef, 0x1ee, 0x044, 0x16d, 0x048, 0x004, 0x010, 0x144, 0x110, 0x100
+};
+
+int corpus_prepare(const char *position);
+
+long corpus_choose(int *row_choice, int *col_choice);
+
+/*
+ * Function:  corpus_clock
+ * --------------------
+ * Read the monotonic wall clock
+ *
+ *  returns: The time in seconds
+ */
+double corpus_clock(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*
+ * Function:  corpus_depth
+ * --------------------
+ * Count the symbols of a corpus position
+ *
+ *  position: The position, cells row by row
+ *
+ *  returns: The number of moves made so far
+ */
+int corpus_depth(const char *position){
+	int cell, depth = 0;
+	for (cell = 0; cell < 9; cell++){
+		if (position[cell] != '_'){
+			depth++;
+		}
+	}
+	return depth;
+}
+
+/*
+ * Function:  compare_times
+ * --------------------
+ * Order two times for qsort
+ *
+ *  a, b: Pointers to the times
+ *
+ *  returns: -1, 0 or 1 as a is smaller, equal or larger
+ */
+int compare_times(const void *a, const void *b){
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+/*
+ * Function:  print_corpus_row
+ * --------------------
+ * Print a CSV row of the corpus benchmark: the engine, the position, the
+ * nodes per search, the nodes per second, the median and 99th percentile
+ * of the wall-clock time per move in microseconds, the move chosen
+ * (3*row + col, -1 for the whole corpus) and the share of the searches
+ * that chose a move keeping the best outcome
+ *
+ *  engine: Name of the version
+ *  position: The position, or "all"
+ *  nodes: Nodes of all the searches
+ *  seconds: Total time of the searches
+ *  times: Time of each search (sorted on return)
+ *  num_of_times: Number of searches
+ *  move: The move chosen
+ *  agreement: Share of the searches that chose a best move
+ *
+ *  returns: 0
+ */
+int print_corpus_row(const char *engine, const char *position, long nodes, double seconds, double *times,
+	int num_of_times, int move, double agreement){
+	qsort(times, num_of_times, sizeof(double), compare_times);
+	printf("%s,%s,%ld,%.0f,%.1f,%.1f,%d,%.3f\n", engine, position, nodes / num_of_times,
+		(seconds > 0) ? nodes / seconds : 0.0, 1e6 * times[(num_of_times - 1) / 2],
+		1e6 * times[(99*num_of_times + 99) / 100 - 1], move, agreement);
+	return 0;
+}
+
+/*
+ * Function:  run_corpus_benchmark
+ * --------------------
+ * Let the computer choose its move in each position of the corpus,
+ * num_of_trials times, and print one CSV row per position and one for the
+ * whole corpus (see print_corpus_row). Only corpus_choose is timed
+ *
+ *  engine: Name of the version, printed in the first column
+ *  num_of_trials: Number of times each position is searched
+ *
+ *  returns: 0, or 1 if the times cannot be stored
+ */
+int run_corpus_benchmark(const char *engine, int num_of_trials){
+	double *times, *all_times;
+	double tic, seconds, position_seconds, total_seconds = 0;
+	long nodes, total_nodes = 0;
+	int position, trial;
+	int row_choice = 0, col_choice = 0;
+	int num_of_agreements, total_agreements = 0;
+
+	times = malloc(num_of_trials * sizeof(double));
+	all_times = malloc(NUM_OF_CORPUS_POSITIONS * num_of_trials * sizeof(double));
+	if ((times == NULL) || (all_times == NULL)){
+		free(times);
+		free(all_times);
+		return 1;
+	}
+	/* The versions drawing a move at random draw the same ones on every run */
+	srand(1);
+	printf("engine,position,nodes,nodes_per_sec,median_us,p99_us,move,agreement\n");
+	for (position = 0; position < NUM_OF_CORPUS_POSITIONS; position++){
+		nodes = 0;
+		position_seconds = 0;
+		num_of_agreements = 0;
+		for (trial = 0; trial < num_of_trials; trial++){
+			corpus_prepare(corpus_positions[position]);
+			tic = corpus_clock();
+			nodes += corpus_choose(&row_choice, &col_choice);
+			seconds = corpus_clock() - tic;
+			position_seconds += seconds;
+			times[trial] = seconds;
+			all_times[position*num_of_trials + trial] = seconds;
+			if ((corpus_best_moves[position] >> (3*row_choice + col_choice)) & 1){
+				num_of_agreements++;
+			}
+		}
+		print_corpus_row(engine, corpus_positions[position], nodes, position_seconds, times, num_of_trials,
+			3*row_choice + col_choice, (double) num_of_agreements / num_of_trials);
+		total_nodes += nodes;
+		total_seconds += position_seconds;
+		total_agreements += num_of_agreements;
+	}
+	print_corpus_row(engine, "all", total_nodes, total_seconds, all_times, NUM_OF_CORPUS_POSITIONS*num_of_trials,
+		-1, (double) total_agreements / (NUM_OF_CORPUS_POSITIONS*num_of_trials));
+	free(times);
+	free(all_times);
+	return 0;
+}
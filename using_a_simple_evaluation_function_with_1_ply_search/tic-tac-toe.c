@@ -22,15 +22,31 @@
 	gcc -ansi -pedantic -W -Wall -o tic-tac-toe  tic-tac-toe.c -pg
 	Then run:
 	./tic-tac-toe
+	To time the computer's move in a fixed corpus of positions (CORPUS_TRIALS
+	times each, or the number of trials given) and print, as CSV, the nodes,
+	the nodes per second, the median and 99th percentile time per move and
+	how often the move keeps the best outcome, run:
+	./tic-tac-toe corpus
 */
 
+#define _POSIX_C_SOURCE 199309L	/* clock_gettime */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #define ARBITRARILY_LOW_VALUE -10000
 #define ARBITRARILY_HIGH_VALUE 10000
 
+/* Number of boards evaluated by computer_choose */
+static long num_of_nodes = 0;
+
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare */
+static char corpus_board[3][3];
+
 int print_board(char board[3][3]);
 
 int is_legal(char board[3][3], int row_choice, int col_choice);
@@ -49,7 +65,7 @@ int num_of_two_rows(char board[3][3], char player);
 
 int num_of_one_rows(char board[3][3], char player);
 
-int main()
+int main(int argc, char *argv[])
 {
 	char board[3][3] =
     {
@@ -60,6 +76,10 @@ int main()
 	int is_maximizer = 1; /* The computer always moves first */
 	int row_choice, col_choice;		
 		
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("1_ply", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+
 	while (1){
 		printf("\n\n");
 		print_board(board);
@@ -262,6 +282,7 @@ int computer_choose(char board[3][3], int *row_choice, int *col_choice){
 				continue;
 			}			
 			board[i][j] = 'x';
+			num_of_nodes++;
 			c3 = num_of_three_rows(board, 'x');
 			n2 = num_of_two_rows(board, 'o');			
 			c2 = num_of_two_rows(board, 'x');
@@ -470,3 +491,35 @@ int num_of_one_rows(char board[3][3], char player){
 	return result;
 }
 
+/*
+ * Function:  corpus_prepare 
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board
+ *    
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	for (cell = 0; cell < 9; cell++){
+		corpus_board[cell / 3][cell % 3] = position[cell];
+	}
+	return 0;
+}
+
+/*
+ * Function:  corpus_choose 
+ * --------------------
+ * Let the computer choose its move in corpus_board
+ *    
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	num_of_nodes = 0;
+	computer_choose(corpus_board, row_choice, col_choice);
+	return num_of_nodes;
+}
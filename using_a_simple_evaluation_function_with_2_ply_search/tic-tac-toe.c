@@ -14,6 +14,13 @@
 		empty spaces)
 	+) c1 is the number of X's 1-rows
 
+	The counts are not recomputed at the leaves. A LineCensus keeps the number
+	of X's and O's on each of the 8 lines together with c3, n2, c2, n1 and c1,
+	the number of O's 3-rows and the number of moves made, and
+	make_move/unmake_move update only the (2 to 4) lines through the cell, so
+	evaluating a leaf is a single weighted sum and telling a won or drawn
+	position needs no look at the board.
+
 	Reference: 
 		[1] Computer Gamesmanship: The Complete Guide to Creating 
 		and Structuring intelligent game programs - David N.L.Levy
@@ -22,15 +29,58 @@
 	gcc -ansi -pedantic -W -Wall -o tic-tac-toe  tic-tac-toe.c -pg
 	Then run:
 	./tic-tac-toe
+	To time the computer's move in a fixed corpus of positions (CORPUS_TRIALS
+	times each, or the number of trials given) and print, as CSV, the nodes,
+	the nodes per second, the median and 99th percentile time per move and
+	how often the move keeps the best outcome, run:
+	./tic-tac-toe corpus
+	To compare the leaves evaluated per second with the line census and with
+	the full rescan of the board it replaced (LEAF_BENCH_ROUNDS rounds of the
+	corpus, or the number of rounds given), run:
+	./tic-tac-toe bench
 */
 
+#define _POSIX_C_SOURCE 199309L	/* clock_gettime */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #define ARBITRARILY_LOW_VALUE -10000
 #define ARBITRARILY_HIGH_VALUE 10000
 
+/* Number of positions visited by search */
+static long num_of_nodes = 0;
+
+/* Number of positions evaluated at the leaves of search and rescan_search */
+static long num_of_leaves = 0;
+
+/* Rounds of the corpus searched by run_leaf_benchmark */
+#define LEAF_BENCH_ROUNDS 200
+
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare */
+static char corpus_board[3][3];
+
+#define NUM_OF_LINES 8
+
+typedef struct LineCensusStruct{
+	int num_of_x[NUM_OF_LINES];	/* Number of X's on each line */
+	int num_of_o[NUM_OF_LINES];	/* Number of O's on each line */
+	int c3, n2, c2, n1, c1;
+	int n3;	/* Number of O's 3-rows */
+	int num_of_moves;	/* Number of symbols on the board */
+} LineCensus;
+
+/* Lines through each cell: rows 0-2, columns 3-5, main diagonal 6, other diagonal 7 */
+static const int lines_of_cell[3][3][4] = {
+	{ {0, 3, 6, -1}, {0, 4, -1, -1}, {0, 5, 7, -1} },
+	{ {1, 3, -1, -1}, {1, 4, 6, 7}, {1, 5, -1, -1} },
+	{ {2, 3, 7, -1}, {2, 4, -1, -1}, {2, 5, 6, -1} }
+};
+
 int print_board(char board[3][3]);
 
 int is_legal(char board[3][3], int row_choice, int col_choice);
@@ -43,17 +93,31 @@ int player_choose(char board[3][3], int *row_choice, int *col_choice);
 
 int computer_choose(char board[3][3], int *row_choice, int *col_choice);
 
-int search(char board[3][3], int is_maximizer, int depth, int max_depth);
+int search(char board[3][3], LineCensus *census, int is_maximizer, int depth, int max_depth);
+
+int evaluation_function(const LineCensus *census);
+
+int init_line_census(const char board[3][3], LineCensus *census);
+
+int update_line_census(LineCensus *census, int line, int sign);
+
+int make_move(char board[3][3], LineCensus *census, int row, int col, char player);
 
-int evaluation_function(const char board[3][3]);
+int unmake_move(char board[3][3], LineCensus *census, int row, int col);
+
+int rescan_search(char board[3][3], int is_maximizer, int depth, int max_depth);
+
+int rescan_evaluation_function(const char board[3][3]);
 
 int num_of_three_rows(const char board[3][3], char player);
 
 int num_of_two_rows(const char board[3][3], char player);
 
-int num_of_one_rows(const char board[3][3], char player);
+int search_corpus(int use_line_census, int values[NUM_OF_CORPUS_POSITIONS][9]);
 
-int main()
+int run_leaf_benchmark(int num_of_rounds);
+
+int main(int argc, char *argv[])
 {
 	char board[3][3] =
     {
@@ -64,6 +128,13 @@ int main()
 	int is_maximizer = 1; /* The computer always moves first */
 	int row_choice, col_choice;		
 		
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("2_ply", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+	if ((argc > 1) && (strcmp(argv[1], "bench") == 0)){
+		return run_leaf_benchmark(((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : LEAF_BENCH_ROUNDS);
+	}
+
 	while (1){
 		printf("\n\n");
 		print_board(board);
@@ -255,17 +326,19 @@ int computer_choose(char board[3][3], int *row_choice, int *col_choice){
 	int i,j;	
 	int best_value;
 	int value;			
+	LineCensus census;
 	best_value = ARBITRARILY_LOW_VALUE;	
 	
+	init_line_census((const char (*)[3]) board, &census);
 	for (i = 0; i < 3; i++){
 		for (j = 0; j < 3; j++) {			
 			if (is_legal(board, i, j) == 0) {
 				continue;
 			}			
-			board[i][j] = 'x';						
-			/* value = evaluation_function((const char (*)[3]) board); */
-			value = search(board, 0, 0, 2);
-			board[i][j] = '_';			
+			make_move(board, &census, i, j, 'x');
+			/* value = evaluation_function(&census); */
+			value = search(board, &census, 0, 0, 2);
+			unmake_move(board, &census, i, j);
 			if (value > best_value) {
 				best_value = value;
 				*row_choice = i;
@@ -276,7 +349,216 @@ int computer_choose(char board[3][3], int *row_choice, int *col_choice){
 	return 0;
 }
 
-int search(char board[3][3], int is_maximizer, int depth, int max_depth){
+int search(char board[3][3], LineCensus *census, int is_maximizer, int depth, int max_depth){
+	int i, j;
+	int value, best_value;
+
+	num_of_nodes++;
+	if (census->c3 > 0){
+		return ARBITRARILY_HIGH_VALUE;
+	}
+	if (census->n3 > 0){
+		return ARBITRARILY_LOW_VALUE;
+	}
+	if (census->num_of_moves == 9){
+		return 0;
+	}
+
+	if (is_maximizer == 1){
+		best_value = ARBITRARILY_LOW_VALUE;
+	} else {
+		best_value = ARBITRARILY_HIGH_VALUE;
+	}
+
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++) {			
+			if (is_legal(board, i, j) == 0) {
+				continue;
+			}
+
+			if (is_maximizer){
+				make_move(board, census, i, j, 'x');
+			} else {
+				make_move(board, census, i, j, 'o');
+			}			
+			if (depth == max_depth){
+				num_of_nodes++;
+				num_of_leaves++;
+				value = evaluation_function(census);
+			} else {
+				value = search(board, census, 1 - is_maximizer, depth + 1, max_depth);	
+			}
+			unmake_move(board, census, i, j);
+
+			if (is_maximizer == 1){
+				if (best_value < value){
+					best_value = value;
+				}
+			} else {
+				if (best_value > value){
+					best_value = value;
+				}
+			}
+		}
+	}	
+
+	return best_value;		
+}
+
+/*
+ * Function:  evaluation_function 
+ * --------------------
+ * Heuristic value of the board, read from the line census
+ *    
+ *  census: The line census of the board   
+ *
+ *  returns: The heuristic value
+ */
+int evaluation_function(const LineCensus *census){
+	/* return 123*c3 - 63*n2 + 31*c2 - 15*n1 + 7*c1; */
+	return 1230*census->c3 - 63*census->n2 + 31*census->c2;
+}
+
+/*
+ * Function:  init_line_census 
+ * --------------------
+ * Count the X's and O's on every line of the board and the resulting c3, n2, 
+ * c2, n1, c1 and n3, and the moves made
+ *    
+ *  board: The board configuration   
+ *  census: The line census (output)
+ *
+ *  returns: 0
+ */
+int init_line_census(const char board[3][3], LineCensus *census){
+	int i, j, k, line;
+	memset(census, 0, sizeof(LineCensus));
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++){
+			if (board[i][j] != '_'){
+				census->num_of_moves++;
+			}
+			for (k = 0; k < 4; k++){
+				line = lines_of_cell[i][j][k];
+				if (line == -1){
+					break;
+				}
+				if (board[i][j] == 'x'){
+					census->num_of_x[line]++;
+				}
+				if (board[i][j] == 'o'){
+					census->num_of_o[line]++;
+				}
+			}
+		}
+	}
+	for (line = 0; line < NUM_OF_LINES; line++){
+		update_line_census(census, line, 1);
+	}
+	return 0;
+}
+
+/*
+ * Function:  update_line_census 
+ * --------------------
+ * Add (or remove) the contribution of one line to c3, n2, c2, n1, c1 and n3
+ *    
+ *  census: The line census   
+ *  line: Index of the line
+ *  sign: 1 to add the contribution and -1 to remove it
+ *
+ *  returns: 0
+ */
+int update_line_census(LineCensus *census, int line, int sign){
+	int num_of_x = census->num_of_x[line];
+	int num_of_o = census->num_of_o[line];
+	if (num_of_o == 0){
+		switch (num_of_x){
+			case 3: census->c3 += sign; break;
+			case 2: census->c2 += sign; break;
+			case 1: census->c1 += sign; break;
+		}
+	} else if (num_of_x == 0){
+		switch (num_of_o){
+			case 3: census->n3 += sign; break;
+			case 2: census->n2 += sign; break;
+			case 1: census->n1 += sign; break;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  make_move 
+ * --------------------
+ * Put a symbol on the board and update the lines through the cell
+ *    
+ *  board: The board configuration   
+ *  census: The line census of the board
+ *  row: Row index of the move
+ *  col: Column index of the move
+ *  player: The player ('x' or 'o')
+ *
+ *  returns: 0
+ */
+int make_move(char board[3][3], LineCensus *census, int row, int col, char player){
+	int k, line;
+	board[row][col] = player;
+	census->num_of_moves++;
+	for (k = 0; k < 4; k++){
+		line = lines_of_cell[row][col][k];
+		if (line == -1){
+			break;
+		}
+		update_line_census(census, line, -1);
+		if (player == 'x'){
+			census->num_of_x[line]++;
+		} else {
+			census->num_of_o[line]++;
+		}
+		update_line_census(census, line, 1);
+	}
+	return 0;
+}
+
+/*
+ * Function:  unmake_move 
+ * --------------------
+ * Take back a move made with make_move
+ *    
+ *  board: The board configuration   
+ *  census: The line census of the board
+ *  row: Row index of the move
+ *  col: Column index of the move
+ *
+ *  returns: 0
+ */
+int unmake_move(char board[3][3], LineCensus *census, int row, int col){
+	int k, line;
+	for (k = 0; k < 4; k++){
+		line = lines_of_cell[row][col][k];
+		if (line == -1){
+			break;
+		}
+		update_line_census(census, line, -1);
+		if (board[row][col] == 'x'){
+			census->num_of_x[line]--;
+		} else {
+			census->num_of_o[line]--;
+		}
+		update_line_census(census, line, 1);
+	}
+	board[row][col] = '_';
+	census->num_of_moves--;
+	return 0;
+}
+
+/*
+	The routines below are the full rescan of the board at every leaf that
+	the line census replaced, kept only as the baseline for run_leaf_benchmark
+*/
+
+int rescan_search(char board[3][3], int is_maximizer, int depth, int max_depth){
 	int i, j;
 	int value, best_value;
 
@@ -308,9 +590,10 @@ int search(char board[3][3], int is_maximizer, int depth, int max_depth){
 				board[i][j] = 'o';				
 			}			
 			if (depth == max_depth){
-				value = evaluation_function((const char (*)[3]) board);
+				num_of_leaves++;
+				value = rescan_evaluation_function((const char (*)[3]) board);
 			} else {
-				value = search(board, 1 - is_maximizer, depth + 1, max_depth);	
+				value = rescan_search(board, 1 - is_maximizer, depth + 1, max_depth);	
 			}
 			board[i][j] = '_';
 
@@ -329,13 +612,11 @@ int search(char board[3][3], int is_maximizer, int depth, int max_depth){
 	return best_value;		
 }
 
-int evaluation_function(const char board[3][3]){
-	int c3, n2, c2, n1, c1;
+int rescan_evaluation_function(const char board[3][3]){
+	int c3, n2, c2;
 	c3 = num_of_three_rows(board, 'x');
 	n2 = num_of_two_rows(board, 'o');			
 	c2 = num_of_two_rows(board, 'x');
-	n1 = num_of_one_rows(board, 'o');
-	c1 = num_of_one_rows(board, 'x');
 	/* return 123*c3 - 63*n2 + 31*c2 - 15*n1 + 7*c1; */
 	return 1230*c3 - 63*n2 + 31*c2;
 }
@@ -460,73 +741,113 @@ int num_of_two_rows(const char board[3][3], char player){
 	return result;
 }
 
-int num_of_one_rows(const char board[3][3], char player){
-	int i,j;
-	int result = 0;
-	int num_of_empty_spaces;
-	int num_of_player_symbols;
-	/* Row */	
-	for (i = 0; i < 3; i++){		
-		num_of_empty_spaces = 0;
-		num_of_player_symbols = 0;
-		for (j = 0; j < 3; j++) {	
-			if (board[i][j] == player){
-				num_of_player_symbols++;
-			} 
-			if (board[i][j] == '_'){
-				num_of_empty_spaces++;
-			} 
+/*
+ * Function:  search_corpus 
+ * --------------------
+ * Search every move of every corpus position as computer_choose does, 
+ * either with the line census (search) or with the full rescan of the 
+ * board at the leaves (rescan_search)
+ *    
+ *  use_line_census: 1 to run search and 0 to run rescan_search
+ *  values: Value of each move, 0 for the occupied cells (output)
+ *
+ *  returns: 0
+ */
+int search_corpus(int use_line_census, int values[NUM_OF_CORPUS_POSITIONS][9]){
+	LineCensus census;
+	int position, cell;
+	for (position = 0; position < NUM_OF_CORPUS_POSITIONS; position++){
+		corpus_prepare(corpus_positions[position]);
+		if (use_line_census){
+			init_line_census((const char (*)[3]) corpus_board, &census);
 		}
-		if ((num_of_empty_spaces == 2) && (num_of_player_symbols == 1)){
-			result++;
+		for (cell = 0; cell < 9; cell++){
+			values[position][cell] = 0;
+			if (corpus_board[cell / 3][cell % 3] != '_'){
+				continue;
+			}
+			if (use_line_census){
+				make_move(corpus_board, &census, cell / 3, cell % 3, 'x');
+				values[position][cell] = search(corpus_board, &census, 0, 0, 2);
+				unmake_move(corpus_board, &census, cell / 3, cell % 3);
+			} else {
+				corpus_board[cell / 3][cell % 3] = 'x';
+				values[position][cell] = rescan_search(corpus_board, 0, 0, 2);
+				corpus_board[cell / 3][cell % 3] = '_';
+			}
 		}
 	}
+	return 0;
+}
 
-	/* Column */
-	for (i = 0; i < 3; i++){		
-		num_of_empty_spaces = 0;
-		num_of_player_symbols = 0;
-		for (j = 0; j < 3; j++) {	
-			if (board[j][i] == player){
-				num_of_player_symbols++;
-			} 
-			if (board[j][i] == '_'){
-				num_of_empty_spaces++;
-			} 
-		}
-		if ((num_of_empty_spaces == 2) && (num_of_player_symbols == 1)){
-			result++;
+/*
+ * Function:  run_leaf_benchmark 
+ * --------------------
+ * Run search_corpus num_of_rounds times with the full rescan and then with 
+ * the line census, and print the leaves evaluated per second (wall clock) 
+ * of each and the speedup
+ *    
+ *  num_of_rounds: Number of times the corpus is searched
+ *
+ *  returns: 0 if both find the same values and leaves, and 1 otherwise
+ */
+int run_leaf_benchmark(int num_of_rounds){
+	static const char *names[2] = {"full rescan", "line census"};
+	static int values[2][NUM_OF_CORPUS_POSITIONS][9];
+	long leaves[2];
+	double tic, seconds[2];
+	int use_line_census, round;
+
+	printf("%-12s %12s %10s %14s\n", "evaluation", "leaves", "seconds", "leaves/sec");
+	for (use_line_census = 0; use_line_census < 2; use_line_census++){
+		num_of_leaves = 0;
+		tic = corpus_clock();
+		for (round = 0; round < num_of_rounds; round++){
+			search_corpus(use_line_census, values[use_line_census]);
 		}
+		seconds[use_line_census] = corpus_clock() - tic;
+		leaves[use_line_census] = num_of_leaves;
+		printf("%-12s %12ld %10.3f %14.0f\n", names[use_line_census], leaves[use_line_census],
+			seconds[use_line_census], leaves[use_line_census] / (seconds[use_line_census] > 0 ? seconds[use_line_census] : 1e-9));
 	}
-
-	/* Diagonals */
-	num_of_empty_spaces = 0;
-	num_of_player_symbols = 0;
-	for (i = 0; i < 3; i++){
-		if (board[i][i] == player){
-				num_of_player_symbols++;
-		} 
-		if (board[i][i] == '_'){
-			num_of_empty_spaces++;
-		} 
-	}
-	if ((num_of_empty_spaces == 2) && (num_of_player_symbols == 1)){
-		result++;
+	if ((memcmp(values[0], values[1], sizeof(values[0])) != 0) || (leaves[0] != leaves[1])){
+		printf("MISMATCH: the line census disagrees with the full rescan (leaves %ld vs %ld)\n",
+			leaves[0], leaves[1]);
+		return 1;
 	}
+	printf("speedup %.2fx\n", (seconds[0] / leaves[0]) / ((seconds[1] > 0 ? seconds[1] : 1e-9) / leaves[1]));
+	return 0;
+}
 
-	num_of_empty_spaces = 0;
-	num_of_player_symbols = 0;
-	for (i = 0; i < 3; i++){
-		if (board[i][2-i] == player){
-				num_of_player_symbols++;
-		} 
-		if (board[i][2-i] == '_'){
-			num_of_empty_spaces++;
-		} 
-	}
-	if ((num_of_empty_spaces == 2) && (num_of_player_symbols == 1)){
-		result++;
+/*
+ * Function:  corpus_prepare 
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board
+ *    
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	for (cell = 0; cell < 9; cell++){
+		corpus_board[cell / 3][cell % 3] = position[cell];
 	}
-	return result;
+	return 0;
 }
 
+/*
+ * Function:  corpus_choose 
+ * --------------------
+ * Let the computer choose its move in corpus_board
+ *    
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	num_of_nodes = 0;
+	computer_choose(corpus_board, row_choice, col_choice);
+	return num_of_nodes;
+}
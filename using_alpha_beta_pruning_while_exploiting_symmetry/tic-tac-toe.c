@@ -16,8 +16,15 @@
 	gcc -ansi -pedantic -W -Wall -o tic-tac-toe  tic-tac-toe.c -pg
 	Then run:
 	./tic-tac-toe
+	To time the computer's move in a fixed corpus of positions (CORPUS_TRIALS
+	times each, or the number of trials given) and print, as CSV, the nodes,
+	the nodes per second, the median and 99th percentile time per move and
+	how often the move keeps the best outcome, run:
+	./tic-tac-toe corpus
 */
 
+#define _POSIX_C_SOURCE 199309L	/* clock_gettime */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +33,15 @@
 #define ARBITRARILY_LOW_VALUE -10000
 #define ARBITRARILY_HIGH_VALUE 10000
 
+/* Number of positions visited by alpha_beta_routine */
+static long num_of_nodes = 0;
+
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare, and its number of moves */
+static char corpus_board[3][3];
+static int corpus_num_of_moves = 0;
+
 int print_board(const char board[3][3]);
 
 int is_legal(const char board[3][3], int row_choice, int col_choice);
@@ -40,7 +56,7 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 
 int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer);
 
-int main()
+int main(int argc, char *argv[])
 {	
 	char board[3][3] =
     {
@@ -55,6 +71,10 @@ int main()
 	clock_t toc;
 	srand(time(NULL));
 
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("symmetry", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+
 	while (1){
 		printf("\n\n");
 		print_board((const char (*)[3]) board);
@@ -349,6 +369,7 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer){
 	int i,j;
 	int value, temp;		
+	num_of_nodes++;
 	if (is_victorious((const char (*)[3]) board, 'x')){
 		return 1;
 	}
@@ -406,3 +427,37 @@ int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_
 	THE_END: return value;
 }
 
+/*
+ * Function:  corpus_prepare 
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board and
+ * count its moves
+ *    
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	for (cell = 0; cell < 9; cell++){
+		corpus_board[cell / 3][cell % 3] = position[cell];
+	}
+	corpus_num_of_moves = corpus_depth(position);
+	return 0;
+}
+
+/*
+ * Function:  corpus_choose 
+ * --------------------
+ * Let the computer choose its move in corpus_board
+ *    
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	num_of_nodes = 0;
+	computer_choose(corpus_board, corpus_num_of_moves, row_choice, col_choice);
+	return num_of_nodes;
+}
@@ -11,6 +11,14 @@
 		+) -1 when 'O' wins
 		+) 0 in case of a draw
 
+	The killer moves are kept per ply (the depth, counted from the start of
+	the game), two for each ply. When a move causes a cutoff it becomes the
+	first killer of its ply and the previous first killer becomes the second.
+	At each node the killers of its ply are tried first (the first killer,
+	then the second), if they are legal there; the other moves follow in the
+	order centre, corners, middle of edges. After each move of the computer,
+	the share of cutoffs found with the first move searched is printed.
+
 	Reference: 
 		[1] Computer Gamesmanship: The Complete Guide to Creating 
 		and Structuring intelligent game programs - David N.L.Levy
@@ -19,8 +27,15 @@
 	gcc -ansi -pedantic -W -Wall -o tic-tac-toe  tic-tac-toe.c -pg
 	Then run:
 	./tic-tac-toe
+	To time the computer's move in a fixed corpus of positions (CORPUS_TRIALS
+	times each, or the number of trials given) and print, as CSV, the nodes,
+	the nodes per second, the median and 99th percentile time per move and
+	how often the move keeps the best outcome, run:
+	./tic-tac-toe corpus
 */
 
+#define _POSIX_C_SOURCE 199309L	/* clock_gettime */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -28,12 +43,30 @@
 
 #define ARBITRARILY_LOW_VALUE -10000
 #define ARBITRARILY_HIGH_VALUE 10000
+#define MAX_PLY 10	/* Depths 0 to 9 */
+#define NUM_OF_KILLERS 2	/* Killer moves per ply */
 
 typedef struct MoveStruct{	
 	int row;
 	int col;
 } Move;
 
+/* Killer moves of each ply, the most recent first ({-1, -1} if none) */
+static Move killer_moves[MAX_PLY][NUM_OF_KILLERS];
+
+/* Number of cutoffs, and of cutoffs caused by the first move searched */
+static long num_of_cutoffs = 0;
+static long num_of_first_move_cutoffs = 0;
+
+/* Number of positions visited by alpha_beta_routine */
+static long num_of_nodes = 0;
+
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare, and its number of moves */
+static char corpus_board[3][3];
+static int corpus_num_of_moves = 0;
+
 int print_board(const char board[3][3]);
 
 int is_legal(const char board[3][3], int row_choice, int col_choice);
@@ -46,11 +79,15 @@ int player_choose(const char board[3][3], int *row_choice, int *col_choice);
 
 int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choice);
 
-int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer, Move *killer_move);
+int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer);
+
+int clear_killer_moves(void);
+
+int store_killer_move(int depth, int row, int col);
 
-int prioritize_killer_move(Move killer_move, int *move_list_row, int *move_list_col);
+int prioritize_killer_moves(const char board[3][3], int depth, int *move_list_row, int *move_list_col);
 
-int main()
+int main(int argc, char *argv[])
 {	
 	char board[3][3] =
     {
@@ -65,15 +102,25 @@ int main()
 	clock_t toc;
 	srand(time(NULL));
 
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("symmetry_killer", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+
 	while (1){
 		printf("\n\n");
 		print_board((const char (*)[3]) board);
 		if (is_maximizer == 1){						
 			printf("Computer's turn (x). Choose row and column: \n");
 			tic = clock();
+			num_of_cutoffs = 0;
+			num_of_first_move_cutoffs = 0;
 			computer_choose(board, depth, &row_choice, &col_choice);
 			toc = clock();
 			printf("Computer thought in: %f seconds\n", (double)(toc - tic) / CLOCKS_PER_SEC);
+			if (num_of_cutoffs > 0){
+				printf("Cutoffs on the first move: %ld of %ld (%.1f%%)\n", num_of_first_move_cutoffs,
+					num_of_cutoffs, 100.0 * num_of_first_move_cutoffs / num_of_cutoffs);
+			}
 			board[row_choice][col_choice] = 'x';			
 			if (is_victorious((const char (*)[3]) board, 'x')){
 				printf("\n\n");
@@ -259,11 +306,9 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 	int value;	
 	static int ordered_move_row[9] = {1, 0, 0, 2, 2, 1, 0, 1, 2};
 	static int ordered_move_col[9] = {1, 0, 2, 0, 2, 0, 1, 2, 1};	
-	Move killer_move;	
 
 	best_value = ARBITRARILY_LOW_VALUE;		
-	killer_move.row = -1;
-	killer_move.col = -1;
+	clear_killer_moves();
 	if (depth == 0){
 		/* Exploit symmetry in the first move (randomly to make the game more fun!) */
 		i = rand() % 3;
@@ -272,24 +317,21 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 				/* First: The centre */
 				i = 1, j = 1;
 				board[i][j] = 'x';	
-				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0, 
-					&killer_move);	
+				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0);	
 				board[i][j] = '_';				
 				break;
 			case 1:
 				/* Second: The corner */
 				i = 0, j = 0;
 				board[i][j] = 'x';	
-				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0,
-					&killer_move);	
+				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0);	
 				board[i][j] = '_';
 				break;
 			case 2: 
 				/* Finally: The middle of edges */
 				i = 0, j = 1;
 				board[i][j] = 'x';	
-				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0,
-					&killer_move);	
+				value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0);	
 				board[i][j] = '_';
 				break;
 		}
@@ -351,8 +393,7 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 				continue;
 			}			
 			board[i][j] = 'x';	
-			value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0, 
-				&killer_move);	
+			value = alpha_beta_routine(board, depth+1, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 0);	
 			board[i][j] = '_';			
 			if (value > best_value) {
 				best_value = value;
@@ -364,13 +405,28 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 	}
 }
 
-int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer, Move *killer_move){
+/*
+ * Function:  alpha_beta_routine 
+ * --------------------
+ * Alpha-beta search, trying the killer moves of the ply first
+ *    
+ *  board: The board configuration   
+ *  depth: Number of moves played since the start of the game
+ *  alpha: Best value the maximizer is already assured of
+ *  beta: Best value the minimizer is already assured of
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *
+ *  returns: The value of the position
+ */
+int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer){
 	int i,j;
 	int value, temp;
 	int move_list_row[9] = {1, 0, 0, 2, 2, 1, 0, 1, 2};
 	int move_list_col[9] = {1, 0, 2, 0, 2, 0, 1, 2, 1};	
 	int move_id;
+	int num_of_moves_searched = 0;
 
+	num_of_nodes++;
 	if (is_victorious((const char (*)[3]) board, 'x')){
 		return 1;
 	}
@@ -381,19 +437,18 @@ int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_
 		return 0;
 	}	
 
+	prioritize_killer_moves((const char (*)[3]) board, depth, move_list_row, move_list_col);
 	if (is_maximizer){	
 		value = ARBITRARILY_LOW_VALUE;	
-		if (((*killer_move).row != -1) || ((*killer_move).col != -1)){			
-			prioritize_killer_move(*killer_move, move_list_row, move_list_col);
-		}
 		for (move_id = 0; move_id < 9; move_id++){
 			i = move_list_row[move_id];
 			j = move_list_col[move_id];
 			if (is_legal((const char (*)[3]) board, i, j) == 0) {
 				continue;
 			}			
+			num_of_moves_searched++;
 			board[i][j] = 'x';
-			temp = alpha_beta_routine(board, depth+1, alpha, beta, 0, killer_move);
+			temp = alpha_beta_routine(board, depth+1, alpha, beta, 0);
 			board[i][j] = '_';
 			if (temp > value){
 				value = temp;
@@ -402,27 +457,20 @@ int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_
 				alpha = value;
 			}				
 			if (alpha >= beta){				
-				(*killer_move).row = i;
-				(*killer_move).col = j;
-				goto THE_END;
+				goto CUTOFF;
 			}
 		}
-		/* No killer move */
-		(*killer_move).row = -1;
-		(*killer_move).col = -1;
 	} else {
 		value = ARBITRARILY_HIGH_VALUE;
-		if (((*killer_move).row != -1) || ((*killer_move).col != -1)){
-			prioritize_killer_move(*killer_move, move_list_row, move_list_col);
-		}
 		for (move_id = 0; move_id < 9; move_id++){
 			i = move_list_row[move_id];
 			j = move_list_col[move_id];
 			if (is_legal((const char (*)[3]) board, i, j) == 0) {
 				continue;
 			}			
+			num_of_moves_searched++;
 			board[i][j] = 'o';
-			temp = alpha_beta_routine(board, depth+1, alpha, beta, 1, killer_move);
+			temp = alpha_beta_routine(board, depth+1, alpha, beta, 1);
 			board[i][j] = '_';
 			if (temp < value){
 				value = temp;
@@ -431,34 +479,131 @@ int alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_
 				beta = value;
 			}
 			if (alpha >= beta){				
-				(*killer_move).row = i;
-				(*killer_move).col = j;
-				goto THE_END;
+				goto CUTOFF;
 			}			
 		}	
-		/* No killer move */
-		(*killer_move).row = -1;
-		(*killer_move).col = -1;	
 	}
-	
-	THE_END: return value;
+	return value;
+
+	CUTOFF:
+	num_of_cutoffs++;
+	if (num_of_moves_searched == 1){
+		num_of_first_move_cutoffs++;
+	}
+	store_killer_move(depth, i, j);
+	return value;
 }
 
-int prioritize_killer_move(Move killer_move, int *move_list_row, int *move_list_col){
-	int move_id;
-	int temp;
-	for (move_id = 0; move_id < 9; move_id++){
-		if ((killer_move.row == move_list_row[move_id]) && (killer_move.col == move_list_col[move_id])){
-			break;
+/*
+ * Function:  clear_killer_moves 
+ * --------------------
+ * Remove the killer moves of every ply
+ *
+ *  returns: 0
+ */
+int clear_killer_moves(void){
+	int depth, k;
+	for (depth = 0; depth < MAX_PLY; depth++){
+		for (k = 0; k < NUM_OF_KILLERS; k++){
+			killer_moves[depth][k].row = -1;
+			killer_moves[depth][k].col = -1;
 		}
 	}
-	temp = move_list_row[move_id];
-	move_list_row[move_id] = move_list_row[0];
-	move_list_row[0] = temp;
+	return 0;
+}
 
-	temp = move_list_col[move_id];
-	move_list_col[move_id] = move_list_col[0];
-	move_list_col[0] = temp;
+/*
+ * Function:  store_killer_move 
+ * --------------------
+ * Make a move that caused a cutoff the first killer of its ply. The first
+ * killer moves to the second slot, unless it is the same move
+ *    
+ *  depth: The ply
+ *  row: Row index of the move
+ *  col: Column index of the move
+ *
+ *  returns: 0
+ */
+int store_killer_move(int depth, int row, int col){
+	if ((killer_moves[depth][0].row == row) && (killer_moves[depth][0].col == col)){
+		return 0;
+	}
+	killer_moves[depth][1] = killer_moves[depth][0];
+	killer_moves[depth][0].row = row;
+	killer_moves[depth][0].col = col;
+	return 0;
+}
+
+/*
+ * Function:  prioritize_killer_moves 
+ * --------------------
+ * Move the killer moves of the ply that are legal on the board to the front
+ * of the move list (the first killer first), keeping the order of the
+ * other moves
+ *    
+ *  board: The board configuration   
+ *  depth: The ply
+ *  move_list_row: Row indices of the moves (input and output)
+ *  move_list_col: Column indices of the moves (input and output)
+ *
+ *  returns: The number of killer moves moved to the front
+ */
+int prioritize_killer_moves(const char board[3][3], int depth, int *move_list_row, int *move_list_col){
+	int k, move_id;
+	int num_of_prioritized = 0;
+	Move killer;
+	for (k = 0; k < NUM_OF_KILLERS; k++){
+		killer = killer_moves[depth][k];
+		if ((killer.row == -1) || (is_legal(board, killer.row, killer.col) == 0)){
+			continue;
+		}
+		for (move_id = num_of_prioritized; move_id < 9; move_id++){
+			if ((killer.row == move_list_row[move_id]) && (killer.col == move_list_col[move_id])){
+				break;
+			}
+		}
+		for (; move_id > num_of_prioritized; move_id--){
+			move_list_row[move_id] = move_list_row[move_id - 1];
+			move_list_col[move_id] = move_list_col[move_id - 1];
+		}
+		move_list_row[num_of_prioritized] = killer.row;
+		move_list_col[num_of_prioritized] = killer.col;
+		num_of_prioritized++;
+	}
+	return num_of_prioritized;
+}
 
+/*
+ * Function:  corpus_prepare 
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board and
+ * count its moves
+ *    
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	for (cell = 0; cell < 9; cell++){
+		corpus_board[cell / 3][cell % 3] = position[cell];
+	}
+	corpus_num_of_moves = corpus_depth(position);
 	return 0;
 }
+
+/*
+ * Function:  corpus_choose 
+ * --------------------
+ * Let the computer choose its move in corpus_board
+ *    
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	num_of_nodes = 0;
+	computer_choose(corpus_board, corpus_num_of_moves, row_choice, col_choice);
+	return num_of_nodes;
+}
@@ -0,0 +1,1242 @@
+/*
+	Generated by ./tic-tac-toe solve for 3x3 with 3 in a row, do not edit.
+	One entry per base-3 index: outcome << 4 | best move, 0 if unreachable
+*/
+
+#if (BOARD_M != 3) || (BOARD_N != 3) || (BOARD_K != 3)
+#error "solved_table.h was generated for another board"
+#endif
+
+static const unsigned char solved_table[19683] = {
+	0x34, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x16, 0x00, 0x00, 0x26, 0x14,
+	0x34, 0x00, 0x00, 0x16, 0x00, 0x34, 0x28, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x34, 0x00, 0x00,
+	0x34, 0x14, 0x16, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x10, 0x16, 0x00,
+	0x28, 0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x14, 0x00, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x11, 0x00, 0x20, 0x00, 0x26, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x37, 0x10, 0x18, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x16, 0x30, 0x38, 0x00, 0x37, 0x00, 0x17, 0x00, 0x18, 0x00, 0x00, 0x00, 0x35, 0x00,
+	0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x35, 0x00,
+	0x15, 0x00, 0x00, 0x16, 0x15, 0x16, 0x00, 0x10, 0x18, 0x00, 0x17, 0x00, 0x17, 0x00, 0x18, 0x00,
+	0x16, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x16, 0x00, 0x00, 0x18, 0x00, 0x17, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x32, 0x00, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x30, 0x00,
+	0x38, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x00,
+	0x30, 0x00, 0x38, 0x00, 0x16, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x37, 0x27, 0x00, 0x00,
+	0x16, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x34, 0x00, 0x12, 0x00, 0x00, 0x26, 0x14, 0x34, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x18, 0x34, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x14, 0x00, 0x34, 0x32, 0x00, 0x32, 0x00, 0x16, 0x00,
+	0x18, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x26, 0x18, 0x38, 0x00, 0x00, 0x34, 0x00, 0x34, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x00, 0x13, 0x00, 0x00, 0x16, 0x13, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x30, 0x00, 0x36, 0x00, 0x00, 0x26,
+	0x12, 0x38, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x30, 0x38, 0x00, 0x37,
+	0x00, 0x17, 0x00, 0x18, 0x00, 0x30, 0x32, 0x00, 0x30, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00,
+	0x18, 0x00, 0x00, 0x28, 0x18, 0x27, 0x00, 0x00, 0x36, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x28, 0x00, 0x00, 0x28, 0x27, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27,
+	0x00, 0x18, 0x26, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x00, 0x12, 0x00, 0x12, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x16, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x11, 0x00, 0x10, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x34, 0x36, 0x00, 0x30, 0x00, 0x34, 0x00, 0x16, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x34,
+	0x16, 0x36, 0x00, 0x00, 0x16, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x17, 0x00, 0x17, 0x00, 0x18, 0x00,
+	0x16, 0x00, 0x16, 0x00, 0x00, 0x16, 0x16, 0x16, 0x00, 0x00, 0x18, 0x00, 0x17, 0x28, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x37, 0x10, 0x12, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x16, 0x38, 0x28, 0x00, 0x28, 0x00, 0x17, 0x00, 0x16, 0x00, 0x00, 0x18, 0x00,
+	0x17, 0x12, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0x10, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x30,
+	0x00, 0x38, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x12, 0x00, 0x00, 0x34, 0x14,
+	0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x10, 0x13, 0x00, 0x34, 0x00,
+	0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x21, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x14,
+	0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x14, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x24,
+	0x00, 0x00, 0x18, 0x00, 0x17, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x31, 0x00,
+	0x00, 0x37, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x12, 0x00, 0x12, 0x00, 0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x00, 0x18, 0x38, 0x00, 0x37, 0x00, 0x17, 0x00, 0x18, 0x00, 0x30, 0x33, 0x00, 0x30, 0x00,
+	0x38, 0x00, 0x13, 0x00, 0x31, 0x00, 0x18, 0x00, 0x00, 0x28, 0x37, 0x27, 0x00, 0x00, 0x13, 0x00,
+	0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x00,
+	0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x35, 0x00, 0x35, 0x25, 0x00, 0x00, 0x00, 0x00, 0x35, 0x25, 0x00, 0x25, 0x00, 0x28,
+	0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+	0x00, 0x00, 0x34, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x00,
+	0x31, 0x00, 0x00, 0x34, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x2f, 0x32, 0x00, 0x12, 0x00, 0x00, 0x14, 0x12, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x14, 0x34, 0x34, 0x00, 0x34, 0x00, 0x17, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x31, 0x00, 0x00, 0x37, 0x30, 0x38, 0x00, 0x32, 0x00,
+	0x18, 0x00, 0x00, 0x28, 0x37, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x18,
+	0x30, 0x33, 0x00, 0x30, 0x00, 0x38, 0x00, 0x13, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27,
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x00, 0x28, 0x00, 0x00,
+	0x28, 0x10, 0x1f, 0x00, 0x18, 0x32, 0x00, 0x32, 0x00, 0x18, 0x00, 0x37, 0x00, 0x38, 0x00, 0x18,
+	0x00, 0x00, 0x28, 0x18, 0x27, 0x00, 0x00, 0x38, 0x00, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x13, 0x00, 0x34, 0x00, 0x14, 0x00, 0x13, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x14,
+	0x00, 0x00, 0x13, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x28,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x10, 0x1f, 0x00, 0x28,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24,
+	0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x12, 0x00, 0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x00, 0x18, 0x28, 0x00, 0x28, 0x00, 0x17, 0x00, 0x18, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x28, 0x00, 0x28,
+	0x00, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x12, 0x12, 0x00, 0x10, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x17, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x00, 0x33, 0x23, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x00, 0x23, 0x00, 0x28,
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x20, 0x00,
+	0x23, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x34, 0x28, 0x00,
+	0x28, 0x00, 0x14, 0x00, 0x14, 0x00, 0x34, 0x00, 0x15, 0x00, 0x00, 0x28, 0x15, 0x27, 0x00, 0x00,
+	0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x38, 0x00, 0x37, 0x00, 0x17, 0x00, 0x18, 0x00, 0x30, 0x00, 0x33, 0x00,
+	0x00, 0x23, 0x18, 0x38, 0x00, 0x00, 0x18, 0x00, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00,
+	0x15, 0x00, 0x00, 0x12, 0x15, 0x12, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15,
+	0x15, 0x18, 0x00, 0x10, 0x00, 0x15, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x17, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x18, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x30, 0x00, 0x38, 0x00, 0x37,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x00, 0x20, 0x00, 0x23, 0x00, 0x14, 0x00, 0x28, 0x00,
+	0x18, 0x00, 0x00, 0x23, 0x18, 0x38, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x12, 0x00, 0x10, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x00, 0x23, 0x13, 0x12, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x13, 0x18, 0x00, 0x10, 0x00, 0x13, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x30, 0x38, 0x00, 0x20,
+	0x00, 0x2f, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x38, 0x00, 0x00, 0x18,
+	0x00, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x28, 0x00, 0x18, 0x00, 0x00,
+	0x28, 0x18, 0x27, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x34, 0x31, 0x00, 0x30,
+	0x00, 0x34, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x17, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x18, 0x00, 0x10, 0x00, 0x17, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x32, 0x28, 0x00, 0x37, 0x00, 0x17, 0x00, 0x18, 0x00, 0x30, 0x00, 0x38,
+	0x00, 0x00, 0x37, 0x30, 0x38, 0x00, 0x00, 0x18, 0x00, 0x17, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x16, 0x00, 0x00,
+	0x24, 0x34, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x16, 0x18, 0x38, 0x00,
+	0x24, 0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x36, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x21, 0x00, 0x00, 0x24, 0x10, 0x16,
+	0x00, 0x14, 0x34, 0x00, 0x24, 0x00, 0x14, 0x00, 0x18, 0x00, 0x34, 0x00, 0x16, 0x00, 0x00, 0x26,
+	0x16, 0x34, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x31, 0x00,
+	0x11, 0x00, 0x00, 0x1f, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x2f, 0x11, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x16, 0x38, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x16, 0x11, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x36, 0x00,
+	0x20, 0x00, 0x28, 0x00, 0x16, 0x00, 0x36, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x36, 0x00, 0x00,
+	0x16, 0x00, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x16, 0x36,
+	0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x36, 0x00, 0x18, 0x16, 0x26, 0x00, 0x26, 0x00, 0x26,
+	0x00, 0x16, 0x00, 0x00, 0x35, 0x00, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x35, 0x25, 0x00, 0x25,
+	0x00, 0x26, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x36, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x20, 0x00, 0x21, 0x00, 0x00, 0x24, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x2f, 0x32, 0x00, 0x16, 0x00, 0x00, 0x26, 0x18, 0x38, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x34, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x31, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x30, 0x38, 0x00,
+	0x32, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x38,
+	0x00, 0x18, 0x36, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x26,
+	0x00, 0x00, 0x26, 0x20, 0x26, 0x00, 0x18, 0x32, 0x00, 0x20, 0x00, 0x22, 0x00, 0x18, 0x00, 0x38,
+	0x00, 0x18, 0x00, 0x00, 0x26, 0x18, 0x38, 0x00, 0x00, 0x36, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x34, 0x00, 0x24, 0x00, 0x14, 0x00, 0x16, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24,
+	0x16, 0x34, 0x00, 0x00, 0x18, 0x00, 0x14, 0x28, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x34, 0x00,
+	0x00, 0x34, 0x16, 0x36, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x36, 0x00, 0x16, 0x18, 0x28,
+	0x00, 0x28, 0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x16, 0x38, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x16, 0x11, 0x28, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x28,
+	0x00, 0x11, 0x00, 0x00, 0x1f, 0x20, 0x28, 0x00, 0x11, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x1f, 0x16, 0x16, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x00, 0x23,
+	0x00, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x16, 0x36,
+	0x00, 0x22, 0x00, 0x38, 0x00, 0x16, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x16, 0x36, 0x00,
+	0x00, 0x16, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x28, 0x00, 0x18, 0x00, 0x00, 0x14, 0x18, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x18, 0x00, 0x18, 0x00, 0x00, 0x14,
+	0x18, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x18, 0x38, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x18,
+	0x00, 0x00, 0x1f, 0x18, 0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x12, 0x00, 0x00,
+	0x00, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x18, 0x18, 0x00, 0x28, 0x00, 0x18, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x10, 0x00, 0x18, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00, 0x18, 0x25, 0x00, 0x25,
+	0x00, 0x18, 0x00, 0x18, 0x00, 0x25, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x25, 0x00, 0x00, 0x18,
+	0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x38,
+	0x00, 0x18, 0x00, 0x00, 0x14, 0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x38,
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x38, 0x00, 0x18, 0x00, 0x00,
+	0x28, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x38,
+	0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00,
+	0x18, 0x18, 0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x18, 0x00, 0x28, 0x00, 0x18, 0x00, 0x00, 0x14,
+	0x18, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x18, 0x28, 0x00, 0x28,
+	0x00, 0x14, 0x00, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x28, 0x00, 0x18, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00,
+	0x18, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x18, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14,
+	0x24, 0x00, 0x00, 0x18, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x28, 0x00, 0x18,
+	0x00, 0x00, 0x1f, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x2f, 0x10, 0x00, 0x12, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x18, 0x28, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x23, 0x00, 0x23,
+	0x00, 0x18, 0x00, 0x18, 0x00, 0x23, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x23, 0x00, 0x00, 0x18,
+	0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x28, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x10, 0x1f, 0x00, 0x28, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00,
+	0x24, 0x00, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x00, 0x23, 0x34, 0x34, 0x00, 0x00,
+	0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x34,
+	0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x15, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x20,
+	0x00, 0x2f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+	0x11, 0x00, 0x00, 0x1f, 0x30, 0x38, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x33,
+	0x11, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x35,
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x10, 0x00, 0x11, 0x00, 0x00,
+	0x1f, 0x15, 0x18, 0x00, 0x11, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x30, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x28, 0x00, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x00, 0x22, 0x00, 0x22,
+	0x00, 0x32, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x28, 0x30, 0x38, 0x00, 0x00, 0x2f, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x23, 0x00, 0x00, 0x23, 0x34, 0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x38,
+	0x00, 0x18, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+	0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x14,
+	0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x10, 0x14, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x20,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x38, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x23, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x13, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x11, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x32, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x32, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00,
+	0x28, 0x18, 0x38, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22,
+	0x00, 0x00, 0x22, 0x32, 0x22, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x12, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x34, 0x22,
+	0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00,
+	0x00, 0x24, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x31, 0x00, 0x11,
+	0x00, 0x00, 0x1f, 0x30, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x31,
+	0x00, 0x11, 0x00, 0x00, 0x1f, 0x30, 0x38, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00,
+	0x38, 0x11, 0x28, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x18, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x32, 0x00, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x30, 0x00, 0x38, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x34, 0x32, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x11, 0x00, 0x30, 0x00, 0x36, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x26, 0x00, 0x30, 0x00, 0x34, 0x00, 0x16, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x28,
+	0x14, 0x24, 0x00, 0x00, 0x16, 0x00, 0x34, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x30, 0x00, 0x36, 0x00, 0x18, 0x00,
+	0x16, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x16, 0x00, 0x00, 0x18, 0x00, 0x36, 0x28, 0x00, 0x00,
+	0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x35, 0x15, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x16, 0x15, 0x16, 0x00, 0x35, 0x00, 0x15, 0x00, 0x16, 0x00, 0x00, 0x18, 0x00,
+	0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0x10, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x00, 0x30,
+	0x00, 0x38, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x00, 0x30, 0x00, 0x34, 0x00,
+	0x14, 0x00, 0x28, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x24, 0x00, 0x00, 0x14, 0x00, 0x34, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x14, 0x14, 0x00, 0x34, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00,
+	0x12, 0x00, 0x12, 0x32, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x00, 0x14, 0x00, 0x18, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x33,
+	0x13, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x13, 0x16, 0x00, 0x33,
+	0x00, 0x13, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+	0x12, 0x38, 0x00, 0x26, 0x00, 0x36, 0x00, 0x18, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16,
+	0x16, 0x00, 0x00, 0x18, 0x00, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x12, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x21, 0x00, 0x10, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x00, 0x26, 0x00, 0x38, 0x00, 0x2f, 0x00, 0x21,
+	0x00, 0x18, 0x00, 0x00, 0x28, 0x2f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x14, 0x00, 0x30, 0x00, 0x34, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0x10, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x28, 0x00, 0x32, 0x00, 0x16,
+	0x00, 0x36, 0x00, 0x16, 0x00, 0x00, 0x36, 0x16, 0x16, 0x00, 0x00, 0x16, 0x00, 0x38, 0x28, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x13, 0x00, 0x30, 0x00, 0x34, 0x00, 0x13, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x24,
+	0x00, 0x00, 0x13, 0x00, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x34,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x10, 0x1f, 0x00, 0x30,
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x12, 0x32, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14,
+	0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x12, 0x00, 0x00, 0x32, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x00, 0x10, 0x18, 0x00, 0x30, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x15,
+	0x00, 0x00, 0x35, 0x10, 0x1f, 0x00, 0x12, 0x12, 0x00, 0x32, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x30, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x38,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x21, 0x00, 0x28, 0x00, 0x00, 0x28, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x14, 0x13, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x13, 0x00, 0x00, 0x00, 0x24,
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x1f, 0x00, 0x12, 0x34, 0x00, 0x32, 0x00, 0x12, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x14, 0x14, 0x24, 0x00, 0x00, 0x34, 0x00, 0x34, 0x34, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x33, 0x00, 0x13, 0x00, 0x00, 0x33, 0x13, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x32, 0x00, 0x12, 0x00, 0x00, 0x32, 0x12,
+	0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x30, 0x38, 0x00, 0x30, 0x00,
+	0x38, 0x00, 0x18, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x38, 0x00, 0x2f, 0x00, 0x21, 0x00, 0x18,
+	0x00, 0x00, 0x28, 0x2f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x22, 0x00, 0x00, 0x28, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x12, 0x32, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x21, 0x00, 0x10, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14,
+	0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x1f, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x34, 0x14,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x00, 0x32, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x38, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x32, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x18, 0x28, 0x00, 0x28,
+	0x00, 0x38, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x28, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x15, 0x28, 0x00, 0x28, 0x00, 0x15, 0x00, 0x18, 0x00, 0x28, 0x00, 0x15,
+	0x00, 0x00, 0x28, 0x15, 0x28, 0x00, 0x00, 0x18, 0x00, 0x15, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x28,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x28, 0x00, 0x28, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x28, 0x00, 0x28, 0x00, 0x14, 0x00, 0x14, 0x00, 0x28,
+	0x00, 0x14, 0x00, 0x00, 0x28, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x28, 0x00, 0x28,
+	0x00, 0x13, 0x00, 0x18, 0x00, 0x28, 0x00, 0x18, 0x00, 0x00, 0x28, 0x18, 0x28, 0x00, 0x00, 0x18,
+	0x00, 0x13, 0x28, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x18, 0x28, 0x00, 0x20, 0x00,
+	0x2f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x28, 0x00, 0x28, 0x00, 0x18, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x28, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x28, 0x00, 0x28, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x34, 0x00, 0x12, 0x00, 0x00, 0x34, 0x14, 0x34, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x15, 0x10, 0x14, 0x00, 0x34, 0x00, 0x17, 0x00, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x00, 0x00, 0x34, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x00,
+	0x31, 0x00, 0x00, 0x34, 0x10, 0x14, 0x00, 0x14, 0x34, 0x00, 0x34, 0x00, 0x16, 0x00, 0x14, 0x00,
+	0x15, 0x00, 0x15, 0x00, 0x00, 0x26, 0x15, 0x14, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x30, 0x00, 0x31, 0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x16, 0x00, 0x00, 0x26, 0x10, 0x1f,
+	0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17,
+	0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x30, 0x00, 0x32, 0x00, 0x37, 0x00, 0x35, 0x00, 0x15, 0x00,
+	0x00, 0x35, 0x15, 0x27, 0x00, 0x00, 0x16, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+	0x32, 0x00, 0x00, 0x32, 0x37, 0x27, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x27, 0x00, 0x15,
+	0x16, 0x26, 0x00, 0x26, 0x00, 0x36, 0x00, 0x16, 0x00, 0x00, 0x35, 0x00, 0x35, 0x25, 0x00, 0x00,
+	0x00, 0x00, 0x15, 0x25, 0x00, 0x25, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x21, 0x00, 0x00, 0x26, 0x20, 0x24, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x32, 0x00, 0x12, 0x00, 0x00, 0x26,
+	0x12, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x30, 0x34, 0x00, 0x26,
+	0x00, 0x36, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x26,
+	0x00, 0x00, 0x26, 0x10, 0x1f, 0x00, 0x32, 0x00, 0x12, 0x00, 0x00, 0x32, 0x12, 0x27, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x36, 0x26, 0x00, 0x26, 0x00, 0x36, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x27, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x26, 0x00, 0x26, 0x00, 0x00, 0x26, 0x20, 0x26, 0x00, 0x12, 0x32, 0x00, 0x32,
+	0x00, 0x12, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x36,
+	0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x00, 0x34, 0x00, 0x17, 0x00, 0x14, 0x00,
+	0x34, 0x00, 0x16, 0x00, 0x00, 0x23, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x34, 0x10, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
+	0x00, 0x34, 0x00, 0x16, 0x10, 0x14, 0x00, 0x14, 0x00, 0x17, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00,
+	0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x37, 0x10, 0x1f,
+	0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x36, 0x30, 0x00, 0x31, 0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x10, 0x1f,
+	0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x26, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x23, 0x00, 0x00,
+	0x00, 0x00, 0x33, 0x23, 0x00, 0x23, 0x00, 0x33, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x00, 0x30, 0x00, 0x32, 0x00, 0x16, 0x00, 0x30, 0x00, 0x36,
+	0x00, 0x00, 0x36, 0x37, 0x27, 0x00, 0x00, 0x16, 0x00, 0x16, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x17, 0x00, 0x17, 0x00,
+	0x00, 0x37, 0x17, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x17, 0x14, 0x00, 0x37, 0x00, 0x17, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x10, 0x00, 0x17, 0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x37, 0x00, 0x17, 0x00,
+	0x00, 0x37, 0x17, 0x27, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x27, 0x00, 0x15, 0x17, 0x11,
+	0x00, 0x37, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x17,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x17, 0x00, 0x00, 0x37, 0x10,
+	0x1f, 0x00, 0x17, 0x25, 0x00, 0x25, 0x00, 0x17, 0x00, 0x17, 0x00, 0x25, 0x00, 0x15, 0x00, 0x00,
+	0x25, 0x15, 0x25, 0x00, 0x00, 0x17, 0x00, 0x17, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x37, 0x00, 0x17, 0x00, 0x00, 0x37, 0x17, 0x14, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x27, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x37, 0x00, 0x17, 0x00, 0x00, 0x37, 0x17, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x12, 0x00, 0x00, 0x12, 0x12, 0x27, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x17, 0x37, 0x00, 0x37, 0x00, 0x17, 0x00, 0x17, 0x00,
+	0x17, 0x00, 0x17, 0x00, 0x00, 0x37, 0x17, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x17, 0x14, 0x00, 0x17, 0x00, 0x17, 0x00, 0x14, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x17,
+	0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x17, 0x24, 0x00, 0x24, 0x00, 0x17, 0x00, 0x14, 0x00, 0x24,
+	0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x17, 0x24, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x10, 0x00, 0x17, 0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x12, 0x00, 0x00, 0x12, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17, 0x00,
+	0x00, 0x00, 0x17, 0x23, 0x00, 0x23, 0x00, 0x17, 0x00, 0x13, 0x00, 0x23, 0x00, 0x17, 0x00, 0x00,
+	0x23, 0x17, 0x23, 0x00, 0x00, 0x13, 0x00, 0x17, 0x23, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x17,
+	0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x17, 0x10,
+	0x1f, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x30, 0x00, 0x33, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15, 0x00,
+	0x00, 0x23, 0x15, 0x14, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x15, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15,
+	0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x10, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x15, 0x14, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x33, 0x00, 0x00, 0x23, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x23,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x35, 0x10, 0x00, 0x15, 0x00, 0x00, 0x15, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11,
+	0x00, 0x10, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x22, 0x00, 0x22, 0x00, 0x32, 0x00, 0x22, 0x00, 0x35, 0x00, 0x15, 0x00, 0x00, 0x35, 0x15,
+	0x27, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x00, 0x00, 0x23, 0x12, 0x14, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x12, 0x14, 0x00, 0x20,
+	0x00, 0x2f, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14,
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x13, 0x00, 0x00, 0x23, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x12, 0x22, 0x00, 0x22, 0x00, 0x12, 0x00, 0x12,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x22, 0x12, 0x22, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x12,
+	0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x14, 0x00, 0x30, 0x00, 0x33, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x34,
+	0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x33, 0x00, 0x00, 0x23, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x37, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x31, 0x00, 0x30, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x36, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x16, 0x00,
+	0x16, 0x00, 0x00, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x2f, 0x26, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x16, 0x16, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x10, 0x00, 0x16, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x00, 0x36, 0x00,
+	0x16, 0x00, 0x00, 0x26, 0x16, 0x36, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16,
+	0x16, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36,
+	0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x16, 0x00, 0x00,
+	0x26, 0x16, 0x26, 0x00, 0x16, 0x25, 0x00, 0x25, 0x00, 0x16, 0x00, 0x16, 0x00, 0x25, 0x00, 0x16,
+	0x00, 0x00, 0x26, 0x16, 0x25, 0x00, 0x00, 0x16, 0x00, 0x16, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x14, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x26, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x2f, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x26, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x12, 0x00, 0x00, 0x26, 0x12, 0x12, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x16, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00,
+	0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x16, 0x16, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x36,
+	0x00, 0x00, 0x00, 0x36, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x16,
+	0x00, 0x16, 0x00, 0x00, 0x14, 0x16, 0x14, 0x00, 0x16, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14,
+	0x00, 0x24, 0x00, 0x16, 0x00, 0x00, 0x24, 0x16, 0x24, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x36, 0x10, 0x00, 0x16, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x16, 0x00, 0x00, 0x1f, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x10, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x23, 0x00, 0x23, 0x00, 0x16, 0x00, 0x16, 0x00, 0x23, 0x00, 0x16,
+	0x00, 0x00, 0x23, 0x16, 0x23, 0x00, 0x00, 0x16, 0x00, 0x16, 0x26, 0x00, 0x00, 0x00, 0x00, 0x36,
+	0x00, 0x16, 0x00, 0x00, 0x36, 0x16, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00,
+	0x16, 0x16, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x23, 0x00, 0x00, 0x23, 0x30, 0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15,
+	0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x24, 0x00, 0x24, 0x00, 0x00,
+	0x24, 0x24, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x14, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x15, 0x14, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x2f, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x32, 0x00, 0x35, 0x00, 0x15, 0x00, 0x00, 0x23, 0x15,
+	0x35, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x00, 0x00,
+	0x22, 0x32, 0x22, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x22, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x15,
+	0x25, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x24, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2f, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x12, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x24, 0x24, 0x00, 0x24, 0x00, 0x2f, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x10, 0x1f, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x22, 0x12, 0x22, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x12, 0x22, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x23, 0x00, 0x33,
+	0x00, 0x00, 0x23, 0x34, 0x34, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x34,
+	0x00, 0x34, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x34, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00,
+	0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x33, 0x10, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3f, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x33,
+	0x23, 0x00, 0x23, 0x00, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x32, 0x22, 0x00, 0x22, 0x00, 0x32, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x00, 0x3f,
+	0x30, 0x3f, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x00, 0x30, 0x00, 0x34, 0x00, 0x14, 0x00,
+	0x15, 0x00, 0x15, 0x00, 0x00, 0x35, 0x15, 0x24, 0x00, 0x00, 0x14, 0x00, 0x34, 0x34, 0x00, 0x00,
+	0x00, 0x00, 0x34, 0x00, 0x15, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x15, 0x14, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00,
+	0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x32, 0x10, 0x1f,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x36,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x10, 0x00, 0x15, 0x00, 0x00, 0x35, 0x10, 0x1f, 0x00, 0x10, 0x1f,
+	0x00, 0x30, 0x00, 0x36, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x26, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x12, 0x32, 0x00, 0x00,
+	0x00, 0x00, 0x15, 0x21, 0x00, 0x10, 0x00, 0x15, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+	0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x32, 0x00, 0x2f, 0x00, 0x21, 0x00, 0x15,
+	0x00, 0x00, 0x35, 0x2f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x00, 0x00, 0x32,
+	0x12, 0x24, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x24, 0x00, 0x34,
+	0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x24, 0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00,
+	0x12, 0x14, 0x00, 0x32, 0x00, 0x12, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x1f, 0x00, 0x00, 0x14, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x13,
+	0x00, 0x00, 0x33, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x26, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x36, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x32,
+	0x00, 0x12, 0x00, 0x2f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x12, 0x00, 0x00, 0x32, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00, 0x26, 0x00, 0x36, 0x00,
+	0x2f, 0x00, 0x00, 0x12, 0x00, 0x12, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x30, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x30, 0x00, 0x34, 0x00, 0x14,
+	0x00, 0x34, 0x00, 0x34, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x10, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f,
+	0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x36, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x32, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x10, 0x1f, 0x00, 0x30, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00,
+	0x10, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x12, 0x00,
+	0x00, 0x00, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x36, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x12, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x24,
+	0x00, 0x14, 0x10, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x31,
+	0x00, 0x00, 0x34, 0x10, 0x1f, 0x00, 0x14, 0x24, 0x00, 0x34, 0x00, 0x12, 0x00, 0x14, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x14, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x30, 0x00, 0x31, 0x00, 0x00, 0x33, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x12, 0x00, 0x00, 0x32, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x35, 0x00,
+	0x00, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x32, 0x00, 0x2f, 0x00, 0x21, 0x00, 0x15, 0x00, 0x00,
+	0x35, 0x2f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31,
+	0x00, 0x00, 0x32, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x10,
+	0x1f, 0x00, 0x30, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x35, 0x25, 0x00, 0x00, 0x00,
+	0x00, 0x15, 0x21, 0x00, 0x25, 0x00, 0x15, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x24, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x21, 0x00, 0x31, 0x00, 0x00, 0x34, 0x24, 0x24, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2f, 0x32, 0x00, 0x12, 0x00, 0x00, 0x32, 0x12,
+	0x24, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x34, 0x34, 0x00, 0x34, 0x00,
+	0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x31, 0x00,
+	0x00, 0x3f, 0x10, 0x1f, 0x00, 0x21, 0x00, 0x12, 0x00, 0x00, 0x32, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x00, 0x30, 0x00, 0x33, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x00, 0x3f, 0x2f, 0x00, 0x00, 0x12, 0x21, 0x00, 0x32, 0x00,
+	0x12, 0x00, 0x2f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+	0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x24,
+	0x00, 0x14, 0x00, 0x00, 0x34, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x34, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x14, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x32, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x33, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x31, 0x00, 0x00, 0x3f, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00,
+	0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x23, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x21, 0x00, 0x23, 0x00, 0x33, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x32, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x00,
+	0x00, 0x3f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x15, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x14, 0x00, 0x15, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15,
+	0x00, 0x00, 0x35, 0x15, 0x24, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x33,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x00, 0x00, 0x23, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x00, 0x00, 0x35, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x10, 0x1f, 0x00, 0x10, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x15,
+	0x21, 0x00, 0x10, 0x00, 0x15, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x00, 0x12,
+	0x00, 0x12, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x14, 0x14, 0x24, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00, 0x14, 0x00,
+	0x14, 0x00, 0x00, 0x14, 0x00, 0x12, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12,
+	0x00, 0x00, 0x23, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x10, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0x00, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x00, 0x22, 0x00, 0x12, 0x00,
+	0x2f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x30, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00, 0x33, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x30, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x30, 0x00, 0x31, 0x00, 0x00, 0x3f, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x10, 0x00,
+	0x14, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00,
+	0x22, 0x00, 0x14, 0x00, 0x16, 0x00, 0x36, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x36, 0x00, 0x00,
+	0x16, 0x00, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x32, 0x00, 0x37, 0x00, 0x17, 0x00, 0x16, 0x00, 0x36, 0x00, 0x16, 0x00,
+	0x00, 0x16, 0x16, 0x36, 0x00, 0x00, 0x35, 0x00, 0x17, 0x25, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00,
+	0x15, 0x00, 0x00, 0x12, 0x15, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16,
+	0x15, 0x25, 0x00, 0x25, 0x00, 0x15, 0x00, 0x16, 0x00, 0x00, 0x12, 0x00, 0x17, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x16, 0x16, 0x00, 0x10, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x16,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x26, 0x00, 0x14, 0x00, 0x13, 0x00, 0x26, 0x00,
+	0x14, 0x00, 0x00, 0x24, 0x14, 0x27, 0x00, 0x00, 0x13, 0x00, 0x14, 0x26, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+	0x00, 0x14, 0x14, 0x14, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x34, 0x00, 0x34, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x24, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x00, 0x12, 0x13, 0x33, 0x00, 0x00,
+	0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16, 0x13, 0x33, 0x00, 0x10, 0x00, 0x13, 0x00, 0x13,
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x30, 0x32, 0x00, 0x37,
+	0x00, 0x17, 0x00, 0x32, 0x00, 0x26, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x36, 0x00, 0x00, 0x36,
+	0x00, 0x17, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x26, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x20, 0x27, 0x00, 0x00, 0x16, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x10,
+	0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x17, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x16, 0x16, 0x00, 0x10, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x00, 0x22, 0x00, 0x17, 0x00, 0x16, 0x00, 0x36, 0x00, 0x16,
+	0x00, 0x00, 0x16, 0x16, 0x36, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x13, 0x00, 0x32, 0x00,
+	0x14, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x14, 0x00, 0x00, 0x13, 0x00,
+	0x35, 0x25, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x24, 0x10, 0x1f, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x10, 0x1f, 0x00, 0x25, 0x00, 0x24, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x14, 0x32, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x12, 0x00,
+	0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x35, 0x25,
+	0x00, 0x25, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x25, 0x00, 0x15, 0x00, 0x00, 0x25, 0x10,
+	0x1f, 0x00, 0x12, 0x32, 0x00, 0x10, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x1f, 0x00, 0x00, 0x35, 0x00, 0x17, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x13, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x14, 0x00, 0x00, 0x24, 0x14, 0x33, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14,
+	0x13, 0x33, 0x00, 0x34, 0x00, 0x14, 0x00, 0x13, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14, 0x00, 0x14, 0x00, 0x00,
+	0x24, 0x14, 0x1f, 0x00, 0x34, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14,
+	0x00, 0x00, 0x24, 0x14, 0x34, 0x00, 0x00, 0x34, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x33, 0x00, 0x13, 0x00, 0x00, 0x13, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x32, 0x00, 0x12, 0x00, 0x00, 0x12, 0x12, 0x32, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x30, 0x31, 0x00, 0x37, 0x00, 0x17, 0x00, 0x37, 0x00,
+	0x30, 0x33, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20,
+	0x27, 0x00, 0x00, 0x13, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x1f, 0x00,
+	0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x22,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x22, 0x00, 0x22, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12,
+	0x00, 0x00, 0x22, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x37, 0x27, 0x00, 0x27, 0x00, 0x24, 0x00, 0x37,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x27, 0x00, 0x00, 0x00, 0x00, 0x37, 0x27,
+	0x00, 0x27, 0x00, 0x17, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00,
+	0x15, 0x27, 0x00, 0x27, 0x00, 0x15, 0x00, 0x15, 0x00, 0x27, 0x00, 0x15, 0x00, 0x00, 0x27, 0x15,
+	0x27, 0x00, 0x00, 0x15, 0x00, 0x15, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00,
+	0x27, 0x27, 0x00, 0x27, 0x00, 0x24, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x27, 0x00, 0x27, 0x00, 0x14, 0x00, 0x14, 0x00, 0x27, 0x00, 0x14, 0x00, 0x00,
+	0x24, 0x14, 0x27, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x27, 0x00, 0x27, 0x00, 0x13, 0x00, 0x13,
+	0x00, 0x27, 0x00, 0x13, 0x00, 0x00, 0x23, 0x13, 0x27, 0x00, 0x00, 0x13, 0x00, 0x13, 0x27, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+	0x00, 0x17, 0x27, 0x00, 0x00, 0x00, 0x00, 0x20, 0x27, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x37, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x27, 0x00,
+	0x20, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00, 0x37,
+	0x27, 0x00, 0x27, 0x00, 0x17, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00,
+	0x24, 0x00, 0x14, 0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x34, 0x00, 0x00,
+	0x35, 0x00, 0x14, 0x25, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x36,
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x25, 0x25, 0x00, 0x25, 0x00, 0x14,
+	0x00, 0x16, 0x00, 0x00, 0x11, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+	0x11, 0x00, 0x00, 0x1f, 0x30, 0x32, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x36, 0x00, 0x16,
+	0x11, 0x25, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x35,
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x25, 0x00, 0x11, 0x00, 0x00,
+	0x1f, 0x15, 0x25, 0x00, 0x11, 0x31, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32, 0x00, 0x10, 0x00, 0x16,
+	0x00, 0x00, 0x1f, 0x16, 0x36, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x36,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x16, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x36, 0x00, 0x00, 0x16, 0x00, 0x20,
+	0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x34,
+	0x00, 0x14, 0x14, 0x34, 0x00, 0x24, 0x00, 0x14, 0x00, 0x13, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+	0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x14,
+	0x00, 0x00, 0x24, 0x14, 0x14, 0x00, 0x34, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x20,
+	0x00, 0x24, 0x00, 0x00, 0x24, 0x34, 0x34, 0x00, 0x00, 0x34, 0x00, 0x14, 0x34, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x16, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x30, 0x32, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x36, 0x00, 0x16, 0x11, 0x31, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x30, 0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x30, 0x36, 0x00, 0x00, 0x36, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x20,
+	0x26, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x16, 0x00, 0x00, 0x32, 0x00, 0x30, 0x32, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x14, 0x11, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22,
+	0x00, 0x22, 0x00, 0x14, 0x00, 0x16, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x24, 0x16, 0x36, 0x00,
+	0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32, 0x00, 0x10, 0x00, 0x16,
+	0x00, 0x00, 0x1f, 0x16, 0x36, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x11, 0x00, 0x00, 0x1f, 0x32, 0x22, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x36, 0x00,
+	0x16, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x16, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x14, 0x00, 0x00, 0x24, 0x30, 0x33, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x25, 0x25, 0x00, 0x25, 0x00, 0x14, 0x00, 0x13,
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x24, 0x25, 0x00, 0x24, 0x00, 0x00, 0x24, 0x10, 0x1f, 0x00, 0x14, 0x25, 0x00, 0x24,
+	0x00, 0x14, 0x00, 0x34, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x34, 0x00, 0x00, 0x35,
+	0x00, 0x14, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x25, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x20,
+	0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x00, 0x12,
+	0x00, 0x00, 0x1f, 0x12, 0x32, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x11,
+	0x25, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x30, 0x33, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x13,
+	0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x13, 0x00, 0x20, 0x25, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x2f, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x35,
+	0x00, 0x20, 0x25, 0x00, 0x00, 0x00, 0x00, 0x20, 0x25, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x35, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x24, 0x00, 0x00,
+	0x24, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x34,
+	0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x14, 0x34, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x32, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x31, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x30, 0x3f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x30, 0x33, 0x00,
+	0x20, 0x00, 0x2f, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f,
+	0x00, 0x30, 0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x30, 0x3f, 0x00, 0x00, 0x31, 0x00, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22,
+	0x00, 0x14, 0x00, 0x13, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x14, 0x00, 0x00, 0x2f,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x24, 0x00, 0x00, 0x24, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x24, 0x00,
+	0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12,
+	0x00, 0x00, 0x1f, 0x12, 0x22, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x12, 0x22, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+	0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x13, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x00, 0x14, 0x00, 0x14, 0x00, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x22, 0x00, 0x24, 0x00, 0x14,
+	0x00, 0x34, 0x00, 0x34, 0x00, 0x14, 0x00, 0x00, 0x24, 0x34, 0x34, 0x00, 0x00, 0x24, 0x00, 0x14,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x31, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32, 0x00, 0x31, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x30,
+	0x33, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00,
+	0x1f, 0x15, 0x35, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15, 0x11, 0x25, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x31, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x20,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x34, 0x00, 0x24, 0x00, 0x14, 0x00, 0x34, 0x00, 0x20, 0x00, 0x24, 0x00, 0x00,
+	0x24, 0x34, 0x34, 0x00, 0x00, 0x14, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14,
+	0x00, 0x00, 0x24, 0x14, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x14,
+	0x24, 0x00, 0x24, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x11, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x31, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x13, 0x33, 0x00, 0x00, 0x00, 0x23, 0x00,
+	0x00, 0x00, 0x33, 0x00, 0x13, 0x11, 0x11, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x11, 0x31, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x3f, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00,
+	0x20, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x22, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x3f,
+	0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x32, 0x00, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x00, 0x14, 0x00, 0x14, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x31, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x22, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32, 0x00, 0x31, 0x00, 0x11, 0x00, 0x00, 0x1f,
+	0x30, 0x3f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x26, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x26,
+	0x00, 0x24, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x36, 0x26, 0x00, 0x00,
+	0x00, 0x00, 0x16, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x15, 0x26, 0x00, 0x26, 0x00, 0x15, 0x00, 0x16, 0x00, 0x26, 0x00, 0x16,
+	0x00, 0x00, 0x26, 0x16, 0x26, 0x00, 0x00, 0x16, 0x00, 0x15, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x00, 0x26, 0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x14, 0x26, 0x00, 0x26, 0x00, 0x14, 0x00, 0x14, 0x00, 0x26,
+	0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x00, 0x14, 0x00, 0x14, 0x26, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x26, 0x00, 0x26,
+	0x00, 0x13, 0x00, 0x13, 0x00, 0x26, 0x00, 0x16, 0x00, 0x00, 0x26, 0x16, 0x26, 0x00, 0x00, 0x13,
+	0x00, 0x13, 0x26, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x36, 0x00, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x26, 0x00,
+	0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x26, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x22, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x26, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x10,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x12, 0x00, 0x32, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x00, 0x35, 0x25, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12,
+	0x00, 0x00, 0x12, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10,
+	0x1f, 0x00, 0x25, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x32, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x13, 0x00, 0x24, 0x00, 0x14,
+	0x00, 0x00, 0x24, 0x14, 0x24, 0x00, 0x00, 0x13, 0x00, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x14, 0x00, 0x00, 0x24, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00,
+	0x14, 0x14, 0x1f, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x32, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x12, 0x00, 0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x33, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x12, 0x32, 0x00, 0x32, 0x00,
+	0x12, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x00,
+	0x30, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x21, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1f, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x00, 0x14, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00
+};
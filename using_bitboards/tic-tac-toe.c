@@ -0,0 +1,5381 @@
+/*
+	Tic-tac-toe (and other m,n,k games) using bitboards
+	Here we assume that the player is the minimizer and the computer is the maximizer
+	Also the computer always moves first ('X')
+
+	The board has BOARD_M rows and BOARD_N columns, and BOARD_K symbols in a
+	row win (3, 3 and 3 unless given with -D when compiling). A position is
+	stored as two masks, one for each side, where cell (row, col) is bit
+	(BOARD_N*row + col). Up to 64 cells a mask is one 64-bit word; larger
+	boards such as Gomoku (15x15, five in a row) use an array of words.
+	Making a move sets a bit, unmaking it clears the bit again, and the legal
+	moves are the complement of both masks.
+
+	Everything that depends on the board size is a compile-time constant, and
+	init_board_tables builds once at startup:
+	+) the winning lines through each cell
+	+) the cells where a line can start in each of the 4 directions, so
+		is_victorious is a fixed number of shift-and-AND operations
+	+) the rotations and reflections of the board (8 for square boards, 4 otherwise)
+	+) the move order, cells on the most winning lines first (for 3x3: centre,
+		corners, middle of edges)
+
+	The board also keeps the number of 'x' and 'o' on every winning line.
+	make_move and unmake_move only update the lines through the cell that was
+	played, which is enough to know when a line is complete and to keep the
+	heuristic evaluation up to date, so both cost O(1) per node. On boards of
+	at most 9 cells the board also keeps its base-3 index (the sum of
+	digit * 3^cell, with digit 0 for '_', 1 for 'x' and 2 for 'o') up to date,
+	and the status of every index (ongoing, 'X' wins, 'O' wins or draw) is
+	looked up in a table computed at startup.
+
+	Each position also has a Zobrist key, the XOR of a random number for every
+	(symbol, cell) on the board, which make_move and unmake_move update with
+	one XOR. alpha_beta_routine stores the value of every position it
+	searches in a fixed-size transposition table indexed by the key, together
+	with whether the value is exact or only a lower/upper bound, the depth it
+	was searched to and the best move. Before searching the moves it looks the
+	position up: a stored value that is deep enough and exact (or a bound
+	outside the window) is returned at once, and otherwise the stored best
+	move is searched first. Scores of won positions are stored relative to
+	the position rather than the root, so they stay valid at any depth.
+	The board actually keeps one key per rotation/reflection (the key of the
+	transformed board), and the table is indexed by the smallest of them, so
+	all the symmetric copies of a position share one entry at every ply. The
+	best move is stored in the frame of that smallest key and mapped back
+	through the inverse transform when it is read.
+	The table is shared by the threads of the parallel searches without a
+	lock: an entry is two 64-bit words, the data (value, best move, draft
+	and bound packed together) and the key XORed with the data, each read
+	and written atomically. A thread that reads the two words of an entry
+	while another is writing it may get one word of each, but then the XOR
+	of the words is not the key it looks for and the entry is ignored.
+
+	Moves are ordered by a move picker before the loop of the search
+	routines: the best move from the transposition table, then the killer
+	move, then the countermove (the move that last refuted the opponent's
+	previous move), then the others by their history score on top of the
+	order of generate_moves. Every move that causes a cutoff adds draft^2 to
+	the history score of its (player, cell), where the draft is the number
+	of plies left below the node, and becomes the countermove of the
+	opponent's previous move. The history scores are halved at each move of
+	the computer, so older searches count less.
+
+	On boards of more than 64 cells only the empty cells at most 2 steps away
+	from a symbol are searched (found by shifting the occupied mask in the 8
+	directions), ordered by how many lines they extend or block, and only the
+	best MAX_CANDIDATES of them.
+
+	The search routines of the other versions are ported to this representation:
+	+) min_max: exhaustive minimax (+10 when 'X' wins, -10 when 'O' wins, 0 if draws)
+	+) alpha_beta_routine: alpha-beta pruning with the killer heuristic
+		(WIN_VALUE - depth when 'X' wins, -(WIN_VALUE - depth) when 'O' wins,
+		0 in case of a draw, and the heuristic evaluation below SEARCH_DEPTH)
+	+) search: depth-limited minimax with the heuristic evaluation function
+		1230*c3 - 63*n2 + 31*c2 (see the 2-ply version), where for k in a row
+		c3 counts the k-rows and n2, c2 the (k-1)-rows. From 4 in a row on,
+		the shorter rows are also counted, each worth a quarter of the next one
+	+) principal_variation_search: the same search in negamax form (the value
+		is from the point of view of the player to move) as Principal
+		Variation Search / NegaScout: the first move is searched with the
+		full window and the others with a null window (alpha, alpha + 1),
+		which only proves that they are not better. A move that fails high
+		is searched again with the full window. It shares the transposition
+		table, killer move and move order with alpha_beta_routine
+	+) mtdf: MTD(f), which finds the value by a series of zero-window
+		alpha_beta_routine searches (beta - 1, beta), each proving that the
+		value is below or at least beta, moving beta to the last result
+		until the two bounds meet. The transposition table keeps the work of
+		the earlier passes. The first guess is the value of the previous
+		iteration, or of the previous move for the first iteration
+	The computer plays with alpha_beta_routine (or principal_variation_search
+	when run as ./tic-tac-toe pvs, or mtdf with ./tic-tac-toe mtdf), using
+	iterative deepening:
+	it searches 1 ply, then 2, 3 and so on up to SEARCH_DEPTH, and each
+	iteration searches the best move of the previous one first (the
+	transposition table also remembers the best replies). Every
+	NODES_BETWEEN_TIME_CHECKS nodes the search compares the wall-clock time
+	with the deadline, TIME_BUDGET seconds after computer_choose was called,
+	and once it has passed the unfinished iteration is abandoned. The best
+	move found so far is played: a move only replaces the previous best one
+	once it is proved better at that depth.
+	Except with mtdf, each iteration is searched with an aspiration window,
+	ASPIRATION_WINDOW on each side of the value of the previous iteration
+	(or of the previous move), rather than the full window. If the value
+	falls outside, the side that failed is widened (twice as far each time)
+	and the iteration is searched again. SEARCH_DEPTH is the whole game
+	on boards of at most 9 cells, 6 plies up to 25 cells, 4 plies up to 64
+	cells and 8 plies on larger boards.
+
+	With ./tic-tac-toe root 4 (or any number of threads, after pvs if
+	wanted) the moves of the computer are searched in parallel at the root:
+	the calling thread and num_of_threads - 1 workers take the next move
+	from a shared counter and search it on their own copy of the board. The
+	best value so far is shared through one atomic word, packed with the
+	index of its move, so every move is searched with the best alpha known
+	when it starts, and a move that fails high ends the hand-out. A move
+	that comes before the current best one in the list is searched with
+	alpha one lower, so that a tie is seen: the move kept is the first best
+	one in the list, as in the serial search. Each thread has its own node
+	counter, history tables and killer move (seeded from the caller's
+	history), and the transposition table is shared. mtdf has no root loop, so it
+	stays serial.
+
+	With ./tic-tac-toe ybw 4 (after pvs if wanted) alpha_beta_routine or
+	principal_variation_search is parallel at interior nodes instead, by Young Brothers Wait: a node at least MIN_SPLIT_DRAFT
+	plies from the horizon searches its first move (the eldest brother)
+	alone, and only if that does not cut off are the other moves put on the
+	work deque of the thread as tasks of a split point. Each thread has
+	one deque: the owner takes tasks from the bottom (the newest, deepest
+	split) and the other threads steal from the top (the oldest, largest
+	subtrees). Each task searches its move on a copy of the board with the
+	current window of the split point, and narrows it for the tasks that
+	start later. A cutoff marks the split point as stopped, and every
+	search below it, on any thread, returns at the next node. The owner
+	of a split point searches its own tasks and then sleeps until the
+	stolen ones are finished, and a worker with nothing to steal sleeps
+	until new tasks are put on a deque. Under principal_variation_search a
+	task searches its move with the null window and again with the whole
+	one if it turns out better, as in the serial loop. The workers run from
+	the start to the end of computer_choose.
+
+	With ./tic-tac-toe lazy 4 the threads share nothing but the
+	transposition table (Lazy SMP): each of the num_of_threads - 1 workers
+	runs its own iterative deepening on a copy of the board, the workers of
+	odd index one ply ahead of the others, while the calling thread
+	searches as in the serial version. The workers only fill the table, so
+	the calling thread finds the values and best moves of the positions
+	they have searched already, and they are stopped when it is done.
+
+	With ./tic-tac-toe selfplay games threads x-engine o-engine seed the
+	program plays games against itself without printing the boards, spread
+	over the threads (each one plays its share of the games on its own
+	board, with its own random number generator, seeded from seed and its
+	index), and prints the games per second and how many games each side
+	won. An engine is random (a random move), ab (alpha_beta_routine), pvs
+	(principal_variation_search) or search (minimax with the evaluation
+	function), followed by :depth for the number of plies searched, for
+	example ./tic-tac-toe selfplay 100000 4 ab:9 random. The moves of each
+	position are shuffled before they are searched and the first best one is
+	played, so the games differ even between two search engines.
+
+	Reference:
+		[1] Computer Gamesmanship: The Complete Guide to Creating
+		and Structuring intelligent game programs - David N.L.Levy
+
+	To compile with gcc, use:
+	gcc -std=c11 -pedantic -W -Wall -O2 -pthread -o tic-tac-toe  tic-tac-toe.c
+	or, for example for 4x4 with 4 in a row:
+	gcc -std=c11 -pedantic -W -Wall -O2 -pthread -DBOARD_M=4 -DBOARD_N=4 -DBOARD_K=4 -o tic-tac-toe  tic-tac-toe.c
+	or for Gomoku:
+	gcc -std=c11 -pedantic -W -Wall -O2 -pthread -DBOARD_M=15 -DBOARD_N=15 -DBOARD_K=5 -o gomoku  tic-tac-toe.c
+	Then run:
+	./tic-tac-toe
+	To compare the nodes per second against the char board[3][3] routines
+	(3x3 only), run:
+	./tic-tac-toe bench
+	which also compares the nodes searched by alpha_beta_routine with and
+	without the transposition table, and by principal_variation_search, and
+	the nodes and passes of the three routines with iterative deepening (on
+	any board size), and the games per second of self-play on 1 to 8 threads.
+	To time the computer's move in the fixed corpus of positions shared with
+	the other versions (3x3 only, CORPUS_TRIALS times each, or the number of
+	trials given) and print the results as CSV, run:
+	./tic-tac-toe corpus
+	To count the leaves of the game tree (the positions depth moves ahead
+	and the games that end before, 255168 games on 3x3) and the leaves per
+	second, with nothing evaluated, run:
+	./tic-tac-toe perft depth threads
+	which counts every depth up to depth (PERFT_DEPTH by default) on one
+	thread and then the last one on 2, 4 ... up to threads threads, and
+	checks the counts that are known (and, on 3x3, the char board[3][3]
+	count). bench runs it too, up to PERFT_DEPTH on 1 to 8 threads.
+	On boards of at most 64 cells, random games can also be played in
+	game pools, POOL_SIZE games per thread stored as arrays of bitmasks
+	(one array for the cells of 'x', one for 'o' and so on) and advanced
+	one move at a time, all together: each step is a few passes over the
+	arrays, with no branch and no call per game. Games that end are counted
+	and started again in place until all the games asked for have been
+	started; the pool then plays the ones left to the end, so that short
+	games are not favoured, with the slots of the games over left idle.
+	Run:
+	./tic-tac-toe pool games threads seed
+	The passes are written for the vectorizer, which does most of them only
+	at -O3, so compile with -O3 -march=native to get the most games per
+	second. bench checks the pools against is_victorious and compares them
+	with random games played one by one.
+
+	On boards of at most 9 cells the whole game can be solved once and the
+	result compiled into the program, so that the computer answers every
+	move with one lookup and no search:
+	./tic-tac-toe solve > solved_table.h
+	gcc -std=c11 -pedantic -W -Wall -O2 -pthread -DUSE_SOLVED_TABLE -o tic-tac-toe  tic-tac-toe.c
+	solved_table.h holds one byte per base-3 index: the outcome with best
+	play (X_WINS, O_WINS or DRAW) in the high 4 bits and the best move for the
+	player to move (the quickest win or the slowest loss) in the low 4 bits,
+	or 0 for boards that cannot be reached. To check every entry of the
+	compiled-in table against a live alpha_beta_routine search, run:
+	./tic-tac-toe verify
+
+	To see what the search does, compile with -DSEARCH_STATS: alpha_beta_routine
+	and min_max then count the nodes, leaf evaluations, terminal positions,
+	cutoffs (and which move in the list caused them), the moves generated and
+	searched at each ply, and the probes, hits and cutoffs of the
+	transposition table, and the counters are printed after each move of
+	the computer and for the whole game. Without it the counting is not
+	compiled at all.
+*/
+
+#define _POSIX_C_SOURCE 200809L	/* clock_gettime */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#define ARBITRARILY_LOW_VALUE -1000000
+#define ARBITRARILY_HIGH_VALUE 1000000
+#define WIN_VALUE 100000
+
+#ifndef BOARD_M
+#define BOARD_M 3	/* Number of rows */
+#endif
+#ifndef BOARD_N
+#define BOARD_N 3	/* Number of columns */
+#endif
+#ifndef BOARD_K
+#define BOARD_K 3	/* Number of symbols in a row needed to win */
+#endif
+
+#if (BOARD_K > BOARD_M) || (BOARD_K > BOARD_N)
+#error "BOARD_K must not be larger than BOARD_M or BOARD_N"
+#endif
+
+#define NUM_OF_CELLS (BOARD_M*BOARD_N)
+#define NO_MOVE -1
+
+/* Rows, columns and both diagonal directions */
+#define NUM_OF_LINES (BOARD_M*(BOARD_N - BOARD_K + 1) + (BOARD_M - BOARD_K + 1)*BOARD_N \
+	+ 2*(BOARD_M - BOARD_K + 1)*(BOARD_N - BOARD_K + 1))
+#define MAX_LINES_PER_CELL (4*BOARD_K)
+
+#if BOARD_M == BOARD_N
+#define NUM_OF_SYMMETRIES 8
+#else
+#define NUM_OF_SYMMETRIES 4
+#endif
+
+#ifndef SEARCH_DEPTH
+#if NUM_OF_CELLS <= 9
+#define SEARCH_DEPTH NUM_OF_CELLS
+#elif NUM_OF_CELLS <= 25
+#define SEARCH_DEPTH 6
+#elif NUM_OF_CELLS <= 64
+#define SEARCH_DEPTH 4
+#else
+#define SEARCH_DEPTH 8
+#endif
+#endif
+
+/* Time allowed for each move of the computer, in seconds */
+#ifndef TIME_BUDGET
+#define TIME_BUDGET 1.0
+#endif
+
+/* Half the width of the first aspiration window (0: none). A line one
+   symbol short of a win is worth 31, so the window holds a few of them */
+#ifndef ASPIRATION_WINDOW
+#define ASPIRATION_WINDOW 50
+#endif
+
+/* The clock is read once every this many nodes (a power of 2) */
+#define NODES_BETWEEN_TIME_CHECKS 1024
+
+#if NUM_OF_CELLS > 64
+#define USE_NEIGHBOURHOOD_MOVES
+#ifndef MAX_CANDIDATES
+#define MAX_CANDIDATES 16
+#endif
+#endif
+
+/* The transposition table has 2^TT_SIZE_LOG2 entries */
+#ifndef TT_SIZE_LOG2
+#if NUM_OF_CELLS <= 9
+#define TT_SIZE_LOG2 16
+#else
+#define TT_SIZE_LOG2 20
+#endif
+#endif
+#define TT_SIZE (1 << TT_SIZE_LOG2)
+
+/* Values of ENTRY_BOUND */
+#define NO_BOUND 0
+#define EXACT_BOUND 1
+#define LOWER_BOUND 2
+#define UPPER_BOUND 3
+
+/* Values above this (or below minus this) are won (or lost) positions */
+#define WIN_THRESHOLD (WIN_VALUE - NUM_OF_CELLS - 1)
+
+#if NUM_OF_CELLS <= 9
+#define USE_TERMINAL_STATUS_TABLE
+#define NUM_OF_INDICES 19683	/* 3^9 */
+#endif
+
+/* Values of Bitboard.status */
+#define ONGOING 0
+#define X_WINS 1
+#define O_WINS 2
+#define DRAW 3
+
+/* Bit index of a cell */
+#define CELL(row, col) (BOARD_N*(row) + (col))
+
+#if NUM_OF_CELLS <= 64
+typedef uint64_t Mask;
+#define EMPTY_MASK ((Mask) 0)
+#define TEST_BIT(mask, cell) (((mask) >> (cell)) & 1)
+#define SET_BIT(mask, cell) ((mask) |= (Mask) 1 << (cell))
+#define CLEAR_BIT(mask, cell) ((mask) &= ~((Mask) 1 << (cell)))
+#else
+#define NUM_OF_WORDS ((NUM_OF_CELLS + 63) / 64)
+typedef struct MaskStruct{
+	uint64_t word[NUM_OF_WORDS];	/* Cell c is bit c % 64 of word c / 64 */
+} Mask;
+static const Mask EMPTY_MASK;
+#define TEST_BIT(mask, cell) (((mask).word[(cell) >> 6] >> ((cell) & 63)) & 1)
+#define SET_BIT(mask, cell) ((mask).word[(cell) >> 6] |= (uint64_t) 1 << ((cell) & 63))
+#define CLEAR_BIT(mask, cell) ((mask).word[(cell) >> 6] &= ~((uint64_t) 1 << ((cell) & 63)))
+#endif
+
+typedef struct BitboardStruct{
+	Mask x;	/* Cells occupied by 'x' */
+	Mask o;	/* Cells occupied by 'o' */
+	uint64_t key[NUM_OF_SYMMETRIES];	/* Zobrist key of the board under each symmetry, key[0] untransformed */
+	int status;	/* ONGOING, X_WINS, O_WINS or DRAW */
+	int num_of_moves;	/* Number of symbols on the board */
+	int moves[NUM_OF_CELLS];	/* Cells played, in order */
+#ifdef USE_TERMINAL_STATUS_TABLE
+	int index;	/* Base-3 encoding of the board */
+#else
+	int score;	/* Heuristic value, the sum of line_value over all the lines */
+	unsigned char num_of_x[NUM_OF_LINES];	/* Number of 'x' on each winning line */
+	unsigned char num_of_o[NUM_OF_LINES];	/* Number of 'o' on each winning line */
+#endif
+} Bitboard;
+
+typedef struct TranspositionEntryStruct{
+	_Atomic uint64_t check;	/* Zobrist key of the position XOR data */
+	_Atomic uint64_t data;	/* Fields below packed by PACK_ENTRY, 0 for an empty entry */
+} TranspositionEntry;
+
+/* Value (relative to the position for won/lost positions), best move found
+   or NO_MOVE, number of plies searched below the position and bound
+   (NO_BOUND, EXACT_BOUND, LOWER_BOUND or UPPER_BOUND) of an entry */
+#define PACK_ENTRY(value, best_move, draft, bound) ((uint64_t) (uint32_t) (value) \
+	| (uint64_t) (uint16_t) (best_move) << 32 | (uint64_t) (uint8_t) (draft) << 48 | (uint64_t) (bound) << 56)
+#define ENTRY_VALUE(data) ((int) (int32_t) (uint32_t) (data))
+#define ENTRY_BEST_MOVE(data) ((int) (int16_t) (uint16_t) ((data) >> 32))
+#define ENTRY_DRAFT(data) ((int) (int8_t) (uint8_t) ((data) >> 48))
+#define ENTRY_BOUND(data) ((int) ((data) >> 56))
+
+/* A root search shared by the threads of ROOT_PARALLEL_SEARCH */
+typedef struct RootSearchStruct{
+	const Bitboard *board;
+	const int *move_list;
+	int num_of_moves;
+	int depth;
+	int beta;
+	int history[2][NUM_OF_CELLS];	/* History tables of the calling thread when the search started */
+	int countermoves[2][NUM_OF_CELLS];
+	atomic_int next_move;	/* Index in move_list of the next move to hand out */
+	atomic_llong best;	/* pack_root_best of the best value proved and its move */
+	atomic_int max_value;	/* Largest value returned, for the fail-soft result */
+	atomic_int aborted;	/* Set when a thread ran out of time */
+	atomic_long num_of_nodes;	/* Nodes of the worker threads */
+} RootSearch;
+
+/* A node of alpha_beta_routine whose younger brothers are searched by YOUNG_BROTHERS_WAIT_SEARCH */
+typedef struct SplitPointStruct{
+	struct SplitPointStruct *parent;	/* Split point the node itself is searched under, or NULL */
+	const Bitboard *board;	/* Board of the node, unchanged until the split point is closed */
+	const int *move_list;
+	int depth;
+	int max_depth;
+	int is_maximizer;
+	atomic_int stop;	/* Set on a cutoff or when the time is up: the searches below return */
+	pthread_mutex_t lock;	/* Guards the fields below */
+	int alpha;
+	int beta;
+	int value;	/* Best value of the moves searched so far */
+	int best_move;
+	int num_of_pending;	/* Tasks put on the deque and not finished */
+	int aborted;	/* Whether a task ran out of time */
+	int use_pvs;	/* Whether the tasks run principal_variation_search rather than alpha_beta_routine */
+	pthread_cond_t done;	/* Signalled when num_of_pending reaches 0 */
+} SplitPoint;
+
+/* A move of a split point, waiting on a work deque */
+typedef struct TaskStruct{
+	SplitPoint *split;
+	int move_id;
+} Task;
+
+#define DEQUE_SIZE (NUM_OF_CELLS*(SEARCH_DEPTH + 1))
+
+/* Tasks of a thread: the owner pushes and pops at the bottom, the other threads steal at the top */
+typedef struct WorkDequeStruct{
+	pthread_mutex_t lock;
+	Task tasks[DEQUE_SIZE];
+	int top;	/* tasks[top .. bottom - 1] are waiting */
+	int bottom;
+} WorkDeque;
+
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare */
+static Bitboard corpus_board;
+#endif
+
+/* Games and search depth of run_self_play_benchmark */
+#if NUM_OF_CELLS <= 9
+#define SELF_PLAY_BENCH_GAMES 20000
+#define SELF_PLAY_BENCH_DEPTH SEARCH_DEPTH
+#else
+#define SELF_PLAY_BENCH_GAMES 200
+#define SELF_PLAY_BENCH_DEPTH 2
+#endif
+
+/* Values of Engine.kind */
+#define RANDOM_ENGINE 0
+#define ALPHA_BETA_ENGINE 1
+#define PRINCIPAL_VARIATION_ENGINE 2
+#define SEARCH_ENGINE 3
+
+/* A player of the self-play games */
+typedef struct EngineStruct{
+	int kind;
+	int depth;	/* Plies searched */
+} Engine;
+
+/* Games of one self-play thread, and their results */
+typedef struct SelfPlayStruct{
+	const Engine *engines;	/* Engine of 'o' and of 'x' */
+	long num_of_games;
+	uint64_t seed;
+	long num_of_results[4];	/* Games ending in each Bitboard.status */
+	long num_of_plies;
+	long num_of_nodes;
+	long num_of_idle_moves;	/* Moves of game pool slots whose game was over and not started again */
+} SelfPlay;
+
+/* perft from the empty board: the threads share out the first moves */
+typedef struct PerftStruct{
+	const Bitboard *board;
+	int depth;
+	atomic_int next_cell;	/* Next first move to be taken by a thread */
+	atomic_long num_of_leaves;
+} Perft;
+
+/* Deepest perft of ./tic-tac-toe perft and of run_benchmark */
+#ifndef PERFT_DEPTH
+#if NUM_OF_CELLS <= 9
+#define PERFT_DEPTH NUM_OF_CELLS
+#elif NUM_OF_CELLS <= 25
+#define PERFT_DEPTH 5
+#elif NUM_OF_CELLS <= 64
+#define PERFT_DEPTH 4
+#else
+#define PERFT_DEPTH 3
+#endif
+#endif
+
+#if NUM_OF_CELLS <= 64
+/* Number of games of a GamePool */
+#ifndef POOL_SIZE
+#define POOL_SIZE 4096
+#endif
+
+/* Moves of a pool checked by run_game_pool_benchmark, and games it plays */
+#define POOL_CHECK_STEPS 100
+#define POOL_BENCH_GAMES 1000000
+
+/*
+	Random games advanced one move at a time, all together: every field is
+	an array with one element per game, so that each step (finding the
+	empty cells, choosing, making the move, finding the games that ended,
+	starting them again) is one pass over an array with no branch, which
+	the compiler can vectorize
+*/
+typedef struct GamePoolStruct{
+	uint64_t x[POOL_SIZE];	/* Cells of 'x' */
+	uint64_t o[POOL_SIZE];	/* Cells of 'o' */
+	uint64_t legal[POOL_SIZE];	/* Empty cells */
+	uint64_t move[POOL_SIZE];	/* Cell of the move chosen, as a mask */
+	uint64_t num_of_moves[POOL_SIZE];
+	uint64_t status[POOL_SIZE];	/* ONGOING, X_WINS, O_WINS or DRAW */
+	uint64_t random_state[POOL_SIZE];	/* xorshift64* state of each game */
+	uint64_t active[POOL_SIZE];	/* All bits set while the game is played, 0 once it is over for good */
+	long num_of_starts_left;	/* Games still to be started in the slots of the games that end */
+	long num_of_active;
+} GamePool;
+#endif
+
+#ifdef SEARCH_STATS
+/* What alpha_beta_routine and min_max did, counted when compiled with -DSEARCH_STATS */
+typedef struct SearchStatsStruct{
+	long nodes;
+	long leaf_evaluations;	/* Positions scored by evaluation_function at the horizon */
+	long terminal_positions;	/* Won, lost or drawn positions reached */
+	long cutoffs;
+	long cutoffs_by_move[NUM_OF_CELLS];	/* Cutoffs caused by the move of each index in the move list */
+	long table_probes;
+	long table_hits;	/* Probes that found the position */
+	long table_cutoffs;	/* Probes whose entry answered the search */
+	/* By number of moves made: nodes whose moves were generated, their legal moves and the moves searched */
+	long expanded_at_ply[NUM_OF_CELLS + 1];
+	long legal_moves_at_ply[NUM_OF_CELLS + 1];
+	long searched_moves_at_ply[NUM_OF_CELLS + 1];
+} SearchStats;
+
+#define COUNT_STAT(statement) statement
+#else
+/* Without -DSEARCH_STATS the counting compiles to nothing */
+#define COUNT_STAT(statement)
+#endif
+
+/* Steps to the next cell of a line: right, down, down-right and down-left */
+static const int direction_row[4] = {0, 1, 1, 1};
+static const int direction_col[4] = {1, 0, 1, -1};
+static const int direction_shift[4] = {1, BOARD_N, BOARD_N + 1, BOARD_N - 1};
+
+/* Cells where a line can start in each direction */
+static Mask line_starts[4];
+
+/* All the cells, and the cells not in the first/last column */
+static Mask full_board;
+static Mask not_first_col;
+static Mask not_last_col;
+
+/* Winning lines through each cell */
+static int cell_lines[NUM_OF_CELLS][MAX_LINES_PER_CELL];
+static int num_of_cell_lines[NUM_OF_CELLS];
+
+/* Image of each cell under each rotation/reflection, the identity first */
+static int symmetry_map[NUM_OF_SYMMETRIES][NUM_OF_CELLS];
+static int inverse_symmetry_map[NUM_OF_SYMMETRIES][NUM_OF_CELLS];
+
+/* Cells on the most winning lines first */
+static int ordered_moves[NUM_OF_CELLS];
+
+/* Random number of each (player, cell), 'o' first */
+static uint64_t zobrist_keys[2][NUM_OF_CELLS];
+
+static TranspositionEntry transposition_table[TT_SIZE];
+
+/* Set to 0 to search without the transposition table */
+static int use_transposition_table = 1;
+
+/* Set to 0 to index the transposition table by key[0] only */
+static int use_canonical_keys = 1;
+
+/* Values of search_routine */
+#define ALPHA_BETA_ROUTINE 0
+#define PRINCIPAL_VARIATION_SEARCH 1
+#define MTDF 2
+
+/* Routine used by computer_choose */
+static int search_routine = ALPHA_BETA_ROUTINE;
+
+/* Time allowed to computer_choose in seconds, 0 for no limit */
+static double time_budget = TIME_BUDGET;
+
+/* Value found by the last search of computer_choose, the first guess of mtdf */
+static int previous_value = 0;
+
+/* Number of zero-window searches made by mtdf */
+static long num_of_passes = 0;
+
+/* Bonus of each place in the order of generate_moves, against the history scores */
+#define RANK_WEIGHT 256
+
+/* History score of each (player, cell), 'o' first (one per thread) */
+static _Thread_local int history_table[2][NUM_OF_CELLS];
+
+/* Move that last refuted each (player, cell) of the opponent, or NO_MOVE (one per thread) */
+static _Thread_local int countermoves[2][NUM_OF_CELLS];
+
+/* Set to 0 to order the moves by the transposition table and killer move only */
+static int use_history_heuristic = 1;
+
+/* Half the width of the first aspiration window, 0 to search with the full window */
+static int aspiration_window = ASPIRATION_WINDOW;
+
+/* Number of searches repeated because the value fell outside the aspiration window */
+static long num_of_researches = 0;
+
+/* Value of a line holding k symbols of one player and none of the other */
+static int x_row_weight[BOARD_K + 1];
+static int o_row_weight[BOARD_K + 1];
+
+#ifdef USE_TERMINAL_STATUS_TABLE
+static int powers_of_three[NUM_OF_CELLS];
+
+/* Status of the board for every base-3 index, filled by init_terminal_status_table */
+static char terminal_status[NUM_OF_INDICES];
+
+/* Heuristic value of the board for every base-3 index */
+static int heuristic_values[NUM_OF_INDICES];
+
+/* Entries of solved_table: outcome << 4 | best move */
+#define SOLVED_OUTCOME(entry) ((entry) >> 4)
+#define SOLVED_MOVE(entry) ((entry) & 15)
+#define SOLVED_NO_MOVE 15
+#endif
+
+#ifdef USE_SOLVED_TABLE
+#ifndef USE_TERMINAL_STATUS_TABLE
+#error "USE_SOLVED_TABLE needs a board of at most 9 cells"
+#endif
+#include "solved_table.h"
+#endif
+
+/* Number of positions visited by the search routines (one per thread) */
+static _Thread_local long num_of_nodes = 0;
+
+/* Wall-clock time at which the search must stop, or 0 for no limit */
+static double search_deadline = 0;
+
+/* Set once the deadline has passed: every search routine then returns at once (one per thread) */
+static _Thread_local int search_aborted = 0;
+
+/* How the search is spread over threads */
+#define SERIAL_SEARCH 0
+#define ROOT_PARALLEL_SEARCH 1
+#define YOUNG_BROTHERS_WAIT_SEARCH 2
+#define LAZY_SMP_SEARCH 3
+
+static int parallel_mode = SERIAL_SEARCH;
+
+#ifndef MAX_THREADS
+#define MAX_THREADS 64
+#endif
+
+/* Number of threads of a parallel search, the calling thread included */
+static int num_of_threads = 1;
+
+/* Nodes closer to the horizon than this are never split */
+#ifndef MIN_SPLIT_DRAFT
+#define MIN_SPLIT_DRAFT 3
+#endif
+
+/* One work deque per thread, indexed by thread_id */
+static WorkDeque work_deques[MAX_THREADS];
+
+/* Index of the thread in work_deques, 0 for the thread that called computer_choose */
+static _Thread_local int thread_id = 0;
+
+/* Split point of the task the thread is searching, or NULL */
+static _Thread_local SplitPoint *current_split = NULL;
+
+/* Set when the search stopped because a split point above it was stopped, rather than for the time */
+static _Thread_local int search_cancelled = 0;
+
+/* Set while the Young Brothers Wait or Lazy SMP workers are running */
+static int helpers_are_running = 0;
+static atomic_int helpers_must_stop;
+static pthread_t helpers[MAX_THREADS];
+static int helper_ids[MAX_THREADS];
+static int num_of_helpers = 0;
+static atomic_long helper_nodes;
+
+/* The Young Brothers Wait workers without a task sleep on work_available
+   until new tasks are put on a deque (work_generation changes) or they are
+   asked to stop */
+static pthread_mutex_t idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_available = PTHREAD_COND_INITIALIZER;
+static atomic_long work_generation;
+
+/* History tables of the calling thread when the workers were started */
+static int helper_history[2][NUM_OF_CELLS];
+static int helper_countermoves[2][NUM_OF_CELLS];
+
+/* State of the xorshift64* random number generator (one per thread) */
+static _Thread_local uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+
+/* Board searched by the Lazy SMP workers */
+static Bitboard helper_board;
+
+#ifdef SEARCH_STATS
+/* Statistics of the search (one per thread) */
+static _Thread_local SearchStats search_stats;
+
+/* Statistics of the worker threads, added to those of the calling thread once they are joined */
+static SearchStats worker_stats;
+static pthread_mutex_t worker_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Entry of the transposition table and keys written by run_table_tearing_test */
+#define TEARING_INDEX 0
+#define NUM_OF_TEARING_KEYS 4
+#define TEARING_THREADS 4
+#define TEARING_WRITES 1000000
+static uint64_t tearing_keys[NUM_OF_TEARING_KEYS];
+static atomic_int tearing_writers_done;
+static atomic_long tearing_torn_reads;
+static atomic_long tearing_accepted_reads;
+static atomic_long tearing_wrong_reads;
+
+int print_board(const Bitboard *board);
+
+int is_legal(const Bitboard *board, int row_choice, int col_choice);
+
+int is_empty(const Bitboard *board, int cell);
+
+int clear_board(Bitboard *board);
+
+int make_move(Bitboard *board, int cell, int is_maximizer);
+
+int unmake_move(Bitboard *board, int cell, int is_maximizer);
+
+int line_value(int num_of_x, int num_of_o);
+
+int is_victorious(Mask mask);
+
+int is_draw(const Bitboard *board);
+
+Mask mask_and(Mask a, Mask b);
+
+Mask mask_or(Mask a, Mask b);
+
+Mask mask_and_not(Mask a, Mask b);
+
+Mask mask_shift(Mask mask, int shift);
+
+int mask_is_empty(Mask mask);
+
+int mask_first_cell(Mask mask);
+
+int generate_moves(const Bitboard *board, int is_maximizer, int *move_list);
+
+int init_board_tables(void);
+
+int init_terminal_status_table(void);
+
+int init_zobrist_keys(void);
+
+int clear_transposition_table(void);
+
+int read_table_entry(int index, uint64_t key, uint64_t *data);
+
+int write_table_entry(int index, uint64_t key, uint64_t data);
+
+int value_to_table(int value, int depth);
+
+int value_from_table(int value, int depth);
+
+int canonical_key(const Bitboard *board, uint64_t *key);
+
+int store_transposition_entry(uint64_t key, int depth, int draft, int value, int bound, int best_move);
+
+int probe_transposition_table(const Bitboard *board, int depth, int draft, int alpha, int beta,
+	int *value, int *table_move, uint64_t *key, int *symmetry);
+
+int num_of_used_entries(void);
+
+Mask transform_mask(Mask mask, int symmetry);
+
+int player_choose(const Bitboard *board, int *row_choice, int *col_choice);
+
+int computer_choose(Bitboard *board, int *row_choice, int *col_choice);
+
+double wall_clock(void);
+
+int time_is_up(void);
+
+long perft(Bitboard *board, int depth, int is_maximizer);
+
+int min_max(Bitboard *board, int is_maximizer);
+
+int alpha_beta_routine(Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	int *killer_move);
+
+int prioritize_killer_move(int killer_move, int *move_list, int num_of_moves);
+
+#ifdef SEARCH_STATS
+int record_cutoff(int move_id);
+
+int add_search_stats(SearchStats *total, const SearchStats *stats);
+
+int merge_worker_stats(void);
+
+int collect_worker_stats(void);
+
+int print_search_stats(const SearchStats *stats, const char *title);
+#endif
+
+int order_moves(const Bitboard *board, int is_maximizer, int killer_move, int table_move, int *move_list,
+	int num_of_moves);
+
+int update_history(const Bitboard *board, int is_maximizer, int cell, int draft);
+
+int clear_history_tables(void);
+
+int age_history_tables(void);
+
+int negate_bound(int bound);
+
+int principal_variation_search(Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	int *killer_move);
+
+int widen_bound(int guess, int delta);
+
+int search_root(Bitboard *board, const int *move_list, int num_of_moves, int depth, int alpha, int beta,
+	int *best_move);
+
+int search_root_move(Bitboard *board, int cell, int depth, int alpha, int beta, int is_first_move, int *killer_move);
+
+int parallel_search_root(const Bitboard *board, const int *move_list, int num_of_moves, int depth, int alpha,
+	int beta, int *best_move);
+
+void *root_worker(void *arg);
+
+int search_root_moves(RootSearch *root);
+
+long long pack_root_best(int value, int move_id, int num_of_moves);
+
+int root_best_value(long long best);
+
+int root_best_move_id(long long best, int num_of_moves);
+
+int start_helpers(const Bitboard *board);
+
+int stop_helpers(void);
+
+void *helper(void *arg);
+
+void *lazy_helper(void *arg);
+
+int can_split(int depth, int max_depth, int num_of_moves);
+
+int split_node(const Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	const int *move_list, int num_of_moves, int value, int *best_move, int use_pvs);
+
+int run_task(Task task);
+
+int pop_task(const SplitPoint *split, Task *task);
+
+int steal_task(Task *task);
+
+int split_is_cancelled(void);
+
+int mtdf(Bitboard *board, int first_guess, int max_depth, int *best_move);
+
+int search(Bitboard *board, int is_maximizer, int depth, int max_depth);
+
+int evaluation_function(const Bitboard *board);
+
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+
+int char_board_min_max(char board[3][3], int is_maximizer);
+
+int char_board_alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer, int *killer_move);
+
+int char_board_search(char board[3][3], int is_maximizer, int depth, int max_depth);
+
+int char_board_is_victorious(const char board[3][3], char player);
+
+int char_board_is_draw(const char board[3][3]);
+
+int char_board_evaluation_function(const char board[3][3]);
+
+long char_board_perft(char board[3][3], int depth, int is_maximizer);
+#endif
+
+int seed_random(uint64_t seed);
+
+int random_below(int n);
+
+int parse_engine(const char *name, Engine *engine);
+
+int engine_choose(Bitboard *board, int is_maximizer, const Engine *engine);
+
+int play_game(const Engine engines[2], int *num_of_plies);
+
+void *self_play_worker(void *arg);
+
+double run_self_play(long num_of_games, int threads, const Engine engines[2], uint64_t seed, SelfPlay *total);
+
+int self_play(int argc, char *argv[]);
+
+int run_benchmark(void);
+
+int run_search_benchmark(void);
+
+int run_iterative_deepening_benchmark(void);
+
+int run_table_tearing_test(void);
+
+uint64_t tearing_fields(uint64_t key, int value);
+
+void *tearing_writer(void *arg);
+
+void *tearing_reader(void *arg);
+
+int run_parallel_benchmark(void);
+
+int run_self_play_benchmark(void);
+
+void *perft_worker(void *arg);
+
+double run_perft(int depth, int threads, long *num_of_leaves);
+
+long expected_perft(int depth);
+
+int run_perft_benchmark(int max_depth, int threads);
+
+#if NUM_OF_CELLS <= 64
+int init_game_pool(GamePool *pool, uint64_t seed, long num_of_games);
+
+int generate_pool_moves(GamePool *pool);
+
+uint64_t count_bits(uint64_t mask);
+
+int choose_pool_moves(GamePool *pool);
+
+int apply_pool_moves(GamePool *pool);
+
+int detect_pool_terminals(GamePool *pool);
+
+long recycle_pool_games(GamePool *pool, SelfPlay *games);
+
+int check_pool_status(const GamePool *pool);
+
+void *game_pool_worker(void *arg);
+
+double run_game_pool(long num_of_games, int threads, uint64_t seed, SelfPlay *total);
+
+int game_pool(int argc, char *argv[]);
+
+int run_game_pool_benchmark(void);
+#endif
+
+#ifdef USE_TERMINAL_STATUS_TABLE
+int solve_position(Bitboard *board, int is_maximizer, int *values, unsigned char *entries);
+
+int print_solved_table(void);
+#endif
+
+#ifdef USE_SOLVED_TABLE
+int verify_solved_table(void);
+#endif
+
+int main(int argc, char *argv[])
+{
+	Bitboard board;
+	int is_maximizer = 1; /* The computer always moves first */
+	int row_choice, col_choice;
+	int depth, arg;
+	double tic;
+	double toc;
+#ifdef SEARCH_STATS
+	SearchStats game_stats;
+	memset(&game_stats, 0, sizeof(game_stats));
+#endif
+
+	init_board_tables();
+	clear_board(&board);
+	if ((argc > 1) && (strcmp(argv[1], "bench") == 0)){
+		return run_benchmark();
+	}
+	if ((argc > 1) && (strcmp(argv[1], "selfplay") == 0)){
+		return self_play(argc, argv);
+	}
+#if NUM_OF_CELLS <= 64
+	if ((argc > 1) && (strcmp(argv[1], "pool") == 0)){
+		return game_pool(argc, argv);
+	}
+#endif
+	if ((argc > 1) && (strcmp(argv[1], "perft") == 0)){
+		return run_perft_benchmark(((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : PERFT_DEPTH,
+			((argc > 3) && (atoi(argv[3]) > 0) && (atoi(argv[3]) <= MAX_THREADS)) ? atoi(argv[3]) : 1);
+	}
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("bitboards", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+#endif
+	for (arg = 1; arg < argc; arg++){
+		if (strcmp(argv[arg], "pvs") == 0){
+			search_routine = PRINCIPAL_VARIATION_SEARCH;
+		} else if (strcmp(argv[arg], "mtdf") == 0){
+			search_routine = MTDF;
+		} else if (strcmp(argv[arg], "root") == 0){
+			parallel_mode = ROOT_PARALLEL_SEARCH;
+		} else if (strcmp(argv[arg], "ybw") == 0){
+			parallel_mode = YOUNG_BROTHERS_WAIT_SEARCH;
+		} else if (strcmp(argv[arg], "lazy") == 0){
+			parallel_mode = LAZY_SMP_SEARCH;
+		} else if ((atoi(argv[arg]) > 0) && (atoi(argv[arg]) <= MAX_THREADS)){
+			num_of_threads = atoi(argv[arg]);
+		}
+	}
+#ifdef USE_TERMINAL_STATUS_TABLE
+	if ((argc > 1) && (strcmp(argv[1], "solve") == 0)){
+		return print_solved_table();
+	}
+#endif
+#ifdef USE_SOLVED_TABLE
+	if ((argc > 1) && (strcmp(argv[1], "verify") == 0)){
+		return verify_solved_table();
+	}
+#endif
+
+	while (1){
+		printf("\n\n");
+		print_board(&board);
+		if (is_maximizer == 1){
+			printf("Computer's turn (x). Choose row and column: \n");
+#ifdef SEARCH_STATS
+			memset(&search_stats, 0, sizeof(search_stats));
+#endif
+			tic = wall_clock();
+			depth = computer_choose(&board, &row_choice, &col_choice);
+			toc = wall_clock();
+			printf("Computer thought in: %f seconds (%d plies)\n", toc - tic, depth);
+#ifdef SEARCH_STATS
+			print_search_stats(&search_stats, "this move");
+			add_search_stats(&game_stats, &search_stats);
+#endif
+			make_move(&board, CELL(row_choice, col_choice), 1);
+			if (is_victorious(board.x)){
+				printf("\n\n");
+				print_board(&board);
+				printf("THE COMPUTER WON! \n");
+				break;
+			}
+			if (board.status == DRAW){
+				printf("\n\n");
+				print_board(&board);
+				printf("IT'S A DRAW! \n");
+				break;
+			}
+			is_maximizer = 0;
+		} else {
+			player_choose(&board, &row_choice, &col_choice);
+			make_move(&board, CELL(row_choice, col_choice), 0);
+			if (is_victorious(board.o)){
+				printf("\n\n");
+				print_board(&board);
+				printf("YOU WON! \n");
+				break;
+			}
+			if (board.status == DRAW){
+				printf("\n\n");
+				print_board(&board);
+				printf("IT'S A DRAW! \n");
+				break;
+			}
+			is_maximizer = 1;
+		}
+	}
+#ifdef SEARCH_STATS
+	print_search_stats(&game_stats, "the game");
+#endif
+	return 0;
+}
+
+/*
+ * Function:  print_board
+ * --------------------
+ * Print the board
+ *
+ *  board: The board configuration
+ *
+ *  returns: 0
+ */
+int print_board(const Bitboard *board){
+	int i, j;
+	/* Two characters per column, three once the numbers reach 10 */
+	int width = (BOARD_N > 9) ? 3 : 2;
+	printf("   ");
+	for (j = 0; j < BOARD_N; j++){
+		printf("%-*d", width, j + 1);
+	}
+	printf("\n  ");
+	for (j = 0; j < width*BOARD_N; j++){
+		printf("_");
+	}
+	printf("\n");
+	for (i = 0; i < BOARD_M; i++){
+		printf("%-2d|", i + 1);
+		for (j = 0; j < BOARD_N; j++){
+			if (TEST_BIT(board->x, CELL(i, j))){
+				printf("%-*c", width, 'x');
+			} else if (TEST_BIT(board->o, CELL(i, j))){
+				printf("%-*c", width, 'o');
+			} else {
+				printf("%-*c", width, '_');
+			}
+		}
+		printf("\n");
+	}
+	return 0;
+}
+
+/*
+ * Function:  is_legal
+ * --------------------
+ * Check if the move is legal or not
+ *
+ *  board: The board configuration
+ *  row_choice: Row index of the move
+ *  col_choice: Column index of the move
+ *
+ *  returns: 1 if the move is legal and 0 otherwise
+ */
+int is_legal(const Bitboard *board, int row_choice, int col_choice){
+	if ((row_choice < 0) || (row_choice >= BOARD_M) || (col_choice < 0) || (col_choice >= BOARD_N)) {
+		return 0;
+	}
+	return is_empty(board, CELL(row_choice, col_choice));
+}
+
+/*
+ * Function:  is_empty
+ * --------------------
+ * Check if a cell is empty
+ *
+ *  board: The board configuration
+ *  cell: Bit index of the cell
+ *
+ *  returns: 1 if the cell is empty and 0 otherwise
+ */
+int is_empty(const Bitboard *board, int cell){
+	return (TEST_BIT(board->x, cell) | TEST_BIT(board->o, cell)) == 0;
+}
+
+/*
+ * Function:  clear_board
+ * --------------------
+ * Remove all the symbols from the board
+ *
+ *  board: The board configuration (output)
+ *
+ *  returns: 0
+ */
+int clear_board(Bitboard *board){
+	memset(board, 0, sizeof(Bitboard));
+	board->x = EMPTY_MASK;
+	board->o = EMPTY_MASK;
+	board->status = ONGOING;
+#ifndef USE_TERMINAL_STATUS_TABLE
+	board->score = NUM_OF_LINES * line_value(0, 0);
+#endif
+	return 0;
+}
+
+/*
+ * Function:  make_move
+ * --------------------
+ * Put a symbol on the board
+ *
+ *  board: The board configuration
+ *  cell: Bit index of the move
+ *  is_maximizer: 1 to play 'x' and 0 to play 'o'
+ *
+ *  returns: 0
+ */
+int make_move(Bitboard *board, int cell, int is_maximizer){
+	int symmetry;
+#ifndef USE_TERMINAL_STATUS_TABLE
+	int k, line;
+#endif
+	if (is_maximizer){
+		SET_BIT(board->x, cell);
+	} else {
+		SET_BIT(board->o, cell);
+	}
+	for (symmetry = 0; symmetry < NUM_OF_SYMMETRIES; symmetry++){
+		board->key[symmetry] ^= zobrist_keys[is_maximizer][symmetry_map[symmetry][cell]];
+	}
+	board->moves[board->num_of_moves++] = cell;
+#ifdef USE_TERMINAL_STATUS_TABLE
+	board->index += (is_maximizer ? 1 : 2) * powers_of_three[cell];
+	board->status = terminal_status[board->index];
+#else
+	/* Only the lines through the new symbol change */
+	for (k = 0; k < num_of_cell_lines[cell]; k++){
+		line = cell_lines[cell][k];
+		board->score -= line_value(board->num_of_x[line], board->num_of_o[line]);
+		if (is_maximizer){
+			if (++board->num_of_x[line] == BOARD_K){
+				board->status = X_WINS;
+			}
+		} else {
+			if (++board->num_of_o[line] == BOARD_K){
+				board->status = O_WINS;
+			}
+		}
+		board->score += line_value(board->num_of_x[line], board->num_of_o[line]);
+	}
+	if ((board->status == ONGOING) && (board->num_of_moves == NUM_OF_CELLS)){
+		board->status = DRAW;
+	}
+#endif
+	return 0;
+}
+
+/*
+ * Function:  unmake_move
+ * --------------------
+ * Take back a move made with make_move
+ *
+ *  board: The board configuration
+ *  cell: Bit index of the move
+ *  is_maximizer: 1 if the move was made by 'x' and 0 otherwise
+ *
+ *  returns: 0
+ */
+int unmake_move(Bitboard *board, int cell, int is_maximizer){
+	int symmetry;
+#ifndef USE_TERMINAL_STATUS_TABLE
+	int k, line;
+#endif
+	if (is_maximizer){
+		CLEAR_BIT(board->x, cell);
+	} else {
+		CLEAR_BIT(board->o, cell);
+	}
+	for (symmetry = 0; symmetry < NUM_OF_SYMMETRIES; symmetry++){
+		board->key[symmetry] ^= zobrist_keys[is_maximizer][symmetry_map[symmetry][cell]];
+	}
+	board->num_of_moves--;
+#ifdef USE_TERMINAL_STATUS_TABLE
+	board->index -= (is_maximizer ? 1 : 2) * powers_of_three[cell];
+#else
+	for (k = 0; k < num_of_cell_lines[cell]; k++){
+		line = cell_lines[cell][k];
+		board->score -= line_value(board->num_of_x[line], board->num_of_o[line]);
+		if (is_maximizer){
+			board->num_of_x[line]--;
+		} else {
+			board->num_of_o[line]--;
+		}
+		board->score += line_value(board->num_of_x[line], board->num_of_o[line]);
+	}
+#endif
+	/* Moves are only made on boards where the game is still going on */
+	board->status = ONGOING;
+	return 0;
+}
+
+/*
+ * Function:  line_value
+ * --------------------
+ * Contribution of one winning line to the heuristic value: x_row_weight[k]
+ * if it holds k 'x' and no 'o', o_row_weight[k] if it holds k 'o' and no 'x'
+ *
+ *  num_of_x: Number of 'x' on the line
+ *  num_of_o: Number of 'o' on the line
+ *
+ *  returns: The value of the line
+ */
+int line_value(int num_of_x, int num_of_o){
+	if (num_of_o == 0){
+		return x_row_weight[num_of_x];
+	}
+	if (num_of_x == 0){
+		return o_row_weight[num_of_o];
+	}
+	return 0;
+}
+
+/*
+ * Function:  is_victorious
+ * --------------------
+ * Check if the player owning the mask is victorious or not. In each direction,
+ * a cell survives the k-th AND if the cell k steps further is also occupied,
+ * so whatever is left after BOARD_K - 1 steps starts a winning line
+ *
+ *  mask: The cells occupied by the player (board.x or board.o)
+ *
+ *  returns: 1 if the player is victorious and 0 otherwise
+ */
+int is_victorious(Mask mask){
+	int direction, k;
+	Mask run, shifted;
+	for (direction = 0; direction < 4; direction++){
+		run = mask_and(mask, line_starts[direction]);
+		shifted = mask;
+		for (k = 1; k < BOARD_K; k++){
+			shifted = mask_shift(shifted, -direction_shift[direction]);
+			run = mask_and(run, shifted);
+		}
+		if (mask_is_empty(run) == 0){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  is_draw
+ * --------------------
+ * Check if the board is full
+ *
+ *  board: The board configuration
+ *
+ *  returns: 1 if the game is draw and 0 otherwise
+ */
+int is_draw(const Bitboard *board){
+	return mask_is_empty(mask_and_not(full_board, mask_or(board->x, board->o)));
+}
+
+/*
+ * Function:  mask_and, mask_or, mask_and_not
+ * --------------------
+ * Bitwise operations on masks
+ *
+ *  a, b: The masks
+ *
+ *  returns: a & b, a | b and a & ~b
+ */
+Mask mask_and(Mask a, Mask b){
+#if NUM_OF_CELLS <= 64
+	return a & b;
+#else
+	int w;
+	for (w = 0; w < NUM_OF_WORDS; w++){
+		a.word[w] &= b.word[w];
+	}
+	return a;
+#endif
+}
+
+Mask mask_or(Mask a, Mask b){
+#if NUM_OF_CELLS <= 64
+	return a | b;
+#else
+	int w;
+	for (w = 0; w < NUM_OF_WORDS; w++){
+		a.word[w] |= b.word[w];
+	}
+	return a;
+#endif
+}
+
+Mask mask_and_not(Mask a, Mask b){
+#if NUM_OF_CELLS <= 64
+	return a & ~b;
+#else
+	int w;
+	for (w = 0; w < NUM_OF_WORDS; w++){
+		a.word[w] &= ~b.word[w];
+	}
+	return a;
+#endif
+}
+
+/*
+ * Function:  mask_shift
+ * --------------------
+ * Move every bit of a mask to a higher (shift > 0) or lower (shift < 0) cell.
+ * Bits shifted past the last cell are dropped
+ *
+ *  mask: The mask
+ *  shift: Number of cells, less than 64 in absolute value
+ *
+ *  returns: The shifted mask
+ */
+Mask mask_shift(Mask mask, int shift){
+#if NUM_OF_CELLS <= 64
+	if (shift >= 0){
+		return (mask << shift) & full_board;
+	}
+	return mask >> -shift;
+#else
+	int w;
+	Mask result;
+	if (shift == 0){
+		return mask;
+	}
+	if (shift > 0){
+		for (w = NUM_OF_WORDS - 1; w >= 0; w--){
+			result.word[w] = mask.word[w] << shift;
+			if (w > 0){
+				result.word[w] |= mask.word[w-1] >> (64 - shift);
+			}
+		}
+		return mask_and(result, full_board);
+	}
+	shift = -shift;
+	for (w = 0; w < NUM_OF_WORDS; w++){
+		result.word[w] = mask.word[w] >> shift;
+		if (w < NUM_OF_WORDS - 1){
+			result.word[w] |= mask.word[w+1] << (64 - shift);
+		}
+	}
+	return result;
+#endif
+}
+
+/*
+ * Function:  mask_is_empty
+ * --------------------
+ * Check if no bit of a mask is set
+ *
+ *  mask: The mask
+ *
+ *  returns: 1 if the mask is empty and 0 otherwise
+ */
+int mask_is_empty(Mask mask){
+#if NUM_OF_CELLS <= 64
+	return mask == 0;
+#else
+	int w;
+	for (w = 0; w < NUM_OF_WORDS; w++){
+		if (mask.word[w]){
+			return 0;
+		}
+	}
+	return 1;
+#endif
+}
+
+/*
+ * Function:  mask_first_cell
+ * --------------------
+ * Find the lowest cell set in a mask
+ *
+ *  mask: The mask, not empty
+ *
+ *  returns: The cell
+ */
+int mask_first_cell(Mask mask){
+#if NUM_OF_CELLS <= 64
+	return __builtin_ctzll(mask);
+#else
+	int w;
+	w = 0;
+	while (mask.word[w] == 0){
+		w++;
+	}
+	return 64*w + __builtin_ctzll(mask.word[w]);
+#endif
+}
+
+/*
+ * Function:  init_board_tables
+ * --------------------
+ * Build the winning lines, the lines through each cell, the symmetries of
+ * the board and the move order for BOARD_M x BOARD_N with BOARD_K in a row
+ *
+ *  returns: 0
+ */
+int init_board_tables(void){
+	int direction, row, col, k, cell, line;
+	int i, j;
+	int key[NUM_OF_CELLS];
+
+	for (i = 0; i < MAX_THREADS; i++){
+		pthread_mutex_init(&work_deques[i].lock, NULL);
+	}
+	full_board = EMPTY_MASK;
+	not_first_col = EMPTY_MASK;
+	not_last_col = EMPTY_MASK;
+	for (row = 0; row < BOARD_M; row++){
+		for (col = 0; col < BOARD_N; col++){
+			SET_BIT(full_board, CELL(row, col));
+			if (col > 0){
+				SET_BIT(not_first_col, CELL(row, col));
+			}
+			if (col < BOARD_N - 1){
+				SET_BIT(not_last_col, CELL(row, col));
+			}
+		}
+	}
+
+	line = 0;
+	for (direction = 0; direction < 4; direction++){
+		line_starts[direction] = EMPTY_MASK;
+		for (row = 0; row < BOARD_M; row++){
+			for (col = 0; col < BOARD_N; col++){
+				i = row + (BOARD_K - 1)*direction_row[direction];
+				j = col + (BOARD_K - 1)*direction_col[direction];
+				if ((i >= BOARD_M) || (j < 0) || (j >= BOARD_N)){
+					continue;
+				}
+				SET_BIT(line_starts[direction], CELL(row, col));
+				for (k = 0; k < BOARD_K; k++){
+					cell = CELL(row + k*direction_row[direction], col + k*direction_col[direction]);
+					cell_lines[cell][num_of_cell_lines[cell]++] = line;
+				}
+				line++;
+			}
+		}
+	}
+
+	for (row = 0; row < BOARD_M; row++){
+		for (col = 0; col < BOARD_N; col++){
+			cell = CELL(row, col);
+			symmetry_map[0][cell] = cell;
+			symmetry_map[1][cell] = CELL(BOARD_M - 1 - row, BOARD_N - 1 - col);
+			symmetry_map[2][cell] = CELL(row, BOARD_N - 1 - col);
+			symmetry_map[3][cell] = CELL(BOARD_M - 1 - row, col);
+#if NUM_OF_SYMMETRIES == 8
+			symmetry_map[4][cell] = CELL(col, row);
+			symmetry_map[5][cell] = CELL(BOARD_N - 1 - col, BOARD_M - 1 - row);
+			symmetry_map[6][cell] = CELL(col, BOARD_M - 1 - row);
+			symmetry_map[7][cell] = CELL(BOARD_N - 1 - col, row);
+#endif
+		}
+	}
+	for (i = 0; i < NUM_OF_SYMMETRIES; i++){
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			inverse_symmetry_map[i][symmetry_map[i][cell]] = cell;
+		}
+	}
+
+	/* Most lines first, then closest to the centre */
+	for (cell = 0; cell < NUM_OF_CELLS; cell++){
+		row = cell / BOARD_N;
+		col = cell % BOARD_N;
+		key[cell] = 1000*num_of_cell_lines[cell]
+			- abs(2*row - (BOARD_M - 1)) - abs(2*col - (BOARD_N - 1));
+		for (i = cell; (i > 0) && (key[ordered_moves[i-1]] < key[cell]); i--){
+			ordered_moves[i] = ordered_moves[i-1];
+		}
+		ordered_moves[i] = cell;
+	}
+
+	/* 1230*c3 - 63*n2 + 31*c2, then a quarter of the value per symbol less */
+	x_row_weight[BOARD_K] = 1230;
+	x_row_weight[BOARD_K - 1] = 31;
+	o_row_weight[BOARD_K - 1] = -63;
+	for (k = BOARD_K - 2; (k > 0) && (BOARD_K >= 4); k--){
+		x_row_weight[k] = x_row_weight[k + 1] / 4;
+		o_row_weight[k] = o_row_weight[k + 1] / 4;
+	}
+
+#ifdef USE_TERMINAL_STATUS_TABLE
+	init_terminal_status_table();
+#endif
+	init_zobrist_keys();
+	clear_history_tables();
+	return 0;
+}
+
+/*
+ * Function:  init_zobrist_keys
+ * --------------------
+ * Fill zobrist_keys with pseudo-random numbers (xorshift64*, with a fixed
+ * seed so that every run searches the same way)
+ *
+ *  returns: 0
+ */
+int init_zobrist_keys(void){
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	int player, cell;
+	for (player = 0; player < 2; player++){
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			zobrist_keys[player][cell] = state * 0x2545F4914F6CDD1DULL;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  clear_transposition_table
+ * --------------------
+ * Mark every entry of the transposition table as empty
+ *
+ *  returns: 0
+ */
+int clear_transposition_table(void){
+	int index;
+	for (index = 0; index < TT_SIZE; index++){
+		write_table_entry(index, 0, 0);
+	}
+	return 0;
+}
+
+/*
+ * Function:  read_table_entry
+ * --------------------
+ * Read an entry of the transposition table, safe against a thread writing
+ * it at the same time
+ *
+ *  index: Index of the entry
+ *  key: Key of the position looked for
+ *  data: The packed fields of the entry (output, set if 1 is returned)
+ *
+ *  returns: 1 if the entry holds the position, whole, and 0 otherwise
+ */
+int read_table_entry(int index, uint64_t key, uint64_t *data){
+	uint64_t check = atomic_load_explicit(&transposition_table[index].check, memory_order_relaxed);
+	*data = atomic_load_explicit(&transposition_table[index].data, memory_order_relaxed);
+	return ((check ^ *data) == key) && (ENTRY_BOUND(*data) != NO_BOUND);
+}
+
+/*
+ * Function:  write_table_entry
+ * --------------------
+ * Write an entry of the transposition table
+ *
+ *  index: Index of the entry
+ *  key: Key of the position
+ *  data: The packed fields of the entry, 0 to empty it
+ *
+ *  returns: 0
+ */
+int write_table_entry(int index, uint64_t key, uint64_t data){
+	atomic_store_explicit(&transposition_table[index].check, key ^ data, memory_order_relaxed);
+	atomic_store_explicit(&transposition_table[index].data, data, memory_order_relaxed);
+	return 0;
+}
+
+/*
+ * Function:  value_to_table
+ * --------------------
+ * Convert a value to be stored in the transposition table. A win found
+ * at depth d scores WIN_VALUE - d from the root; in the table it is kept
+ * as the number of plies from the position itself
+ *
+ *  value: The value, relative to the root
+ *  depth: Number of plies from the root to the position
+ *
+ *  returns: The value relative to the position
+ */
+int value_to_table(int value, int depth){
+	if (value > WIN_THRESHOLD){
+		return value + depth;
+	}
+	if (value < -WIN_THRESHOLD){
+		return value - depth;
+	}
+	return value;
+}
+
+/*
+ * Function:  value_from_table
+ * --------------------
+ * Inverse of value_to_table
+ *
+ *  value: The value, relative to the position
+ *  depth: Number of plies from the root to the position
+ *
+ *  returns: The value relative to the root
+ */
+int value_from_table(int value, int depth){
+	if (value > WIN_THRESHOLD){
+		return value - depth;
+	}
+	if (value < -WIN_THRESHOLD){
+		return value + depth;
+	}
+	return value;
+}
+
+/*
+ * Function:  canonical_key
+ * --------------------
+ * Find the key the position is stored under in the transposition table:
+ * the smallest key over the rotations and reflections of the board
+ *
+ *  board: The board configuration
+ *  key: The canonical key (output)
+ *
+ *  returns: Index in symmetry_map of the transform giving the canonical key
+ */
+int canonical_key(const Bitboard *board, uint64_t *key){
+	int symmetry, result = 0;
+	*key = board->key[0];
+	if (use_canonical_keys == 0){
+		return 0;
+	}
+	for (symmetry = 1; symmetry < NUM_OF_SYMMETRIES; symmetry++){
+		if (board->key[symmetry] < *key){
+			*key = board->key[symmetry];
+			result = symmetry;
+		}
+	}
+	return result;
+}
+
+/*
+ * Function:  store_transposition_entry
+ * --------------------
+ * Store the result of a search in the transposition table. An entry of
+ * another position is always replaced, an entry of the same position only
+ * by a search at least as deep
+ *
+ *  key: The canonical key of the position
+ *  depth: Number of plies from the root
+ *  draft: Number of plies searched below the position
+ *  value: The value returned by the search
+ *  bound: EXACT_BOUND, LOWER_BOUND (the search failed high) or UPPER_BOUND
+ *	(the search failed low)
+ *  best_move: Best move found in the frame of the canonical key, or NO_MOVE
+ *
+ *  returns: 0
+ */
+int store_transposition_entry(uint64_t key, int depth, int draft, int value, int bound, int best_move){
+	int index = (int) (key & (TT_SIZE - 1));
+	uint64_t data;
+	if ((read_table_entry(index, key, &data) == 0) || (ENTRY_DRAFT(data) <= draft)){
+		write_table_entry(index, key, PACK_ENTRY(value_to_table(value, depth), best_move, draft, bound));
+	}
+	return 0;
+}
+
+/*
+ * Function:  probe_transposition_table
+ * --------------------
+ * Look a position up in the transposition table
+ *
+ *  board: The board configuration
+ *  depth: Number of plies from the root
+ *  draft: Number of plies that will be searched below the position
+ *  alpha, beta: The search window, from the point of view of 'x'
+ *  value: The stored value, relative to the root (output, set if 1 is returned)
+ *  table_move: The stored best move, or NO_MOVE (output)
+ *  key: The canonical key of the position (output)
+ *  symmetry: The transform giving the canonical key (output)
+ *
+ *  returns: 1 if the stored value is deep enough and exact or a bound outside
+ *	the window, so that the position need not be searched, and 0 otherwise
+ */
+int probe_transposition_table(const Bitboard *board, int depth, int draft, int alpha, int beta,
+	int *value, int *table_move, uint64_t *key, int *symmetry){
+	uint64_t data;
+	int bound;
+	*symmetry = canonical_key(board, key);
+	*table_move = NO_MOVE;
+	COUNT_STAT(search_stats.table_probes++);
+	if (read_table_entry((int) (*key & (TT_SIZE - 1)), *key, &data) == 0){
+		return 0;
+	}
+	COUNT_STAT(search_stats.table_hits++);
+	if (ENTRY_BEST_MOVE(data) != NO_MOVE){
+		*table_move = inverse_symmetry_map[*symmetry][ENTRY_BEST_MOVE(data)];
+	}
+	if (ENTRY_DRAFT(data) < draft){
+		return 0;
+	}
+	*value = value_from_table(ENTRY_VALUE(data), depth);
+	bound = ENTRY_BOUND(data);
+	if ((bound == EXACT_BOUND)
+		|| ((bound == LOWER_BOUND) && (*value >= beta))
+		|| ((bound == UPPER_BOUND) && (*value <= alpha))){
+		COUNT_STAT(search_stats.table_cutoffs++);
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * Function:  num_of_used_entries
+ * --------------------
+ * Count the entries of the transposition table holding a position
+ *
+ *  returns: The number of entries
+ */
+int num_of_used_entries(void){
+	int index, result = 0;
+	for (index = 0; index < TT_SIZE; index++){
+		if (ENTRY_BOUND(atomic_load_explicit(&transposition_table[index].data, memory_order_relaxed)) != NO_BOUND){
+			result++;
+		}
+	}
+	return result;
+}
+
+/*
+ * Function:  transform_mask
+ * --------------------
+ * Apply a rotation/reflection of the board to a mask
+ *
+ *  mask: The mask
+ *  symmetry: Index of the rotation/reflection in symmetry_map
+ *
+ *  returns: The transformed mask
+ */
+Mask transform_mask(Mask mask, int symmetry){
+	int cell;
+	Mask result = EMPTY_MASK;
+	for (cell = 0; cell < NUM_OF_CELLS; cell++){
+		if (TEST_BIT(mask, cell)){
+			SET_BIT(result, symmetry_map[symmetry][cell]);
+		}
+	}
+	return result;
+}
+
+#ifdef USE_TERMINAL_STATUS_TABLE
+/*
+ * Function:  init_terminal_status_table
+ * --------------------
+ * Decode every base-3 index into a board and store whether it is ongoing,
+ * won by 'x', won by 'o' or drawn, and its heuristic value. Boards where
+ * both players have a line cannot be reached and are marked as won by 'x'
+ *
+ *  returns: 0
+ */
+int init_terminal_status_table(void){
+	int index, cell, digits, k, line;
+	int num_of_x[NUM_OF_LINES], num_of_o[NUM_OF_LINES];
+	Bitboard board;
+	powers_of_three[0] = 1;
+	for (cell = 1; cell < NUM_OF_CELLS; cell++){
+		powers_of_three[cell] = 3*powers_of_three[cell - 1];
+	}
+	for (index = 0; index < 3*powers_of_three[NUM_OF_CELLS - 1]; index++){
+		board.x = 0;
+		board.o = 0;
+		memset(num_of_x, 0, sizeof(num_of_x));
+		memset(num_of_o, 0, sizeof(num_of_o));
+		digits = index;
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			for (k = 0; k < num_of_cell_lines[cell]; k++){
+				if (digits % 3 == 1){
+					num_of_x[cell_lines[cell][k]]++;
+				} else if (digits % 3 == 2){
+					num_of_o[cell_lines[cell][k]]++;
+				}
+			}
+			if (digits % 3 == 1){
+				SET_BIT(board.x, cell);
+			} else if (digits % 3 == 2){
+				SET_BIT(board.o, cell);
+			}
+			digits /= 3;
+		}
+		heuristic_values[index] = 0;
+		for (line = 0; line < NUM_OF_LINES; line++){
+			heuristic_values[index] += line_value(num_of_x[line], num_of_o[line]);
+		}
+		if (is_victorious(board.x)){
+			terminal_status[index] = X_WINS;
+		} else if (is_victorious(board.o)){
+			terminal_status[index] = O_WINS;
+		} else if (is_draw(&board)){
+			terminal_status[index] = DRAW;
+		} else {
+			terminal_status[index] = ONGOING;
+		}
+	}
+	return 0;
+}
+#endif
+
+/*
+ * Function:  player_choose
+ * --------------------
+ * Ask player to enter the next move. Will run until the entered move is correct
+ *
+ *  board: The board configuration
+ *  row_choice: Row index of the move (output)
+ *  col_choice: Column index of the move (output)
+ *
+ *  returns: 0
+ */
+int player_choose(const Bitboard *board, int *row_choice, int *col_choice){
+	do {
+		printf("Your turn (o). Choose row and column: \n");
+		if (scanf("%d %d", row_choice, col_choice) != 2){
+			exit(0);
+		}
+		(*row_choice)--;
+		(*col_choice)--;
+		if (is_legal(board, *row_choice, *col_choice)){
+			return 0;
+		} else {
+			printf("Illegal move! Please choose again!\n");
+		}
+	} while (1);
+}
+
+/*
+ * Function:  computer_choose
+ * --------------------
+ * Run an AI routine to choose the best move for the computer
+ * Here we use alpha-beta pruning (or Principal Variation Search, or MTD(f))
+ * with the killer heuristic and iterative deepening within time_budget
+ * seconds, or look the move up in solved_table when it is compiled in
+ *
+ *  board: The board configuration
+ *  row_choice: Row index of the move (output)
+ *  col_choice: Column index of the move (output)
+ *
+ *  returns: The depth of the last finished iteration, or 0 when the move
+ *	comes from solved_table
+ */
+int computer_choose(Bitboard *board, int *row_choice, int *col_choice){
+	int best_value, best_move;
+	int value;
+	int move_list[NUM_OF_CELLS];
+	int num_of_moves;
+	int depth, completed_depth = 0;
+	int alpha, beta, delta;
+
+#ifdef USE_SOLVED_TABLE
+	best_move = SOLVED_MOVE(solved_table[board->index]);
+	*row_choice = best_move / BOARD_N;
+	*col_choice = best_move % BOARD_N;
+	return 0;
+#endif
+	num_of_moves = generate_moves(board, 1, move_list);
+	/* In case not even the first iteration finishes */
+	best_move = move_list[0];
+	search_deadline = (time_budget > 0) ? wall_clock() + time_budget : 0;
+	search_aborted = 0;
+	age_history_tables();
+	start_helpers(board);
+	best_value = previous_value;
+	for (depth = 1; (depth <= SEARCH_DEPTH) && (depth <= NUM_OF_CELLS - board->num_of_moves); depth++){
+		if (search_routine == MTDF){
+			/* The value of the previous iteration is the first guess */
+			value = mtdf(board, best_value, depth, &best_move);
+		} else {
+			/* Aspiration window around the value of the previous iteration */
+			delta = aspiration_window;
+			if ((delta > 0) && (best_value >= -WIN_THRESHOLD) && (best_value <= WIN_THRESHOLD)){
+				alpha = widen_bound(best_value, -delta);
+				beta = widen_bound(best_value, delta);
+			} else {
+				alpha = ARBITRARILY_LOW_VALUE;
+				beta = ARBITRARILY_HIGH_VALUE;
+			}
+			while (1){
+				prioritize_killer_move(best_move, move_list, num_of_moves);
+				value = search_root(board, move_list, num_of_moves, depth, alpha, beta, &best_move);
+				if (search_aborted){
+					break;
+				}
+				/* Widen the side that failed and search again */
+				if ((value <= alpha) && (alpha > ARBITRARILY_LOW_VALUE)){
+					delta *= 2;
+					alpha = widen_bound(best_value, -delta);
+				} else if ((value >= beta) && (beta < ARBITRARILY_HIGH_VALUE)){
+					delta *= 2;
+					beta = widen_bound(best_value, delta);
+				} else {
+					break;
+				}
+				num_of_researches++;
+			}
+		}
+		if (search_aborted){
+			break;
+		}
+		best_value = value;
+		completed_depth = depth;
+		previous_value = best_value;
+		/* A forced win or loss will not change with more depth */
+		if ((best_value > WIN_THRESHOLD) || (best_value < -WIN_THRESHOLD)){
+			break;
+		}
+	}
+	stop_helpers();
+	search_deadline = 0;
+	*row_choice = best_move / BOARD_N;
+	*col_choice = best_move % BOARD_N;
+	return completed_depth;
+}
+
+/*
+ * Function:  widen_bound
+ * --------------------
+ * Bound of an aspiration window, or the infinite bound once the window
+ * reaches the values of won or lost positions
+ *
+ *  guess: Centre of the window
+ *  delta: Distance from the centre, negative for the lower bound
+ *
+ *  returns: The bound
+ */
+int widen_bound(int guess, int delta){
+	if (guess + delta < -WIN_THRESHOLD){
+		return ARBITRARILY_LOW_VALUE;
+	}
+	if (guess + delta > WIN_THRESHOLD){
+		return ARBITRARILY_HIGH_VALUE;
+	}
+	return guess + delta;
+}
+
+/*
+ * Function:  search_root
+ * --------------------
+ * Search the moves of the computer ('x') in the window (alpha, beta), with
+ * alpha raised to the best value found so far
+ *
+ *  board: The board configuration
+ *  move_list: The moves, best first
+ *  num_of_moves: Number of moves
+ *  depth: Depth of the iteration
+ *  alpha, beta: The window
+ *  best_move: Best move (output, only changed for a move that is proved
+ *	better than the others searched and than alpha, so it can be kept even
+ *	if the search is abandoned later)
+ *
+ *  returns: The best value, an upper bound if it is at most alpha and a
+ *	lower bound if it is at least beta
+ */
+int search_root(Bitboard *board, const int *move_list, int num_of_moves, int depth, int alpha, int beta,
+	int *best_move){
+	int move_id, value;
+	int best_value = ARBITRARILY_LOW_VALUE;
+	int killer_move = NO_MOVE;
+	if ((parallel_mode == ROOT_PARALLEL_SEARCH) && (num_of_threads > 1) && (num_of_moves > 1)){
+		return parallel_search_root(board, move_list, num_of_moves, depth, alpha, beta, best_move);
+	}
+	for (move_id = 0; move_id < num_of_moves; move_id++){
+		value = search_root_move(board, move_list[move_id], depth, alpha, beta, move_id == 0, &killer_move);
+		if (search_aborted){
+			break;
+		}
+		if (value > best_value){
+			best_value = value;
+		}
+		if (value > alpha){
+			alpha = value;
+			*best_move = move_list[move_id];
+			if (value >= beta){
+				break;
+			}
+		}
+	}
+	return best_value;
+}
+
+/*
+ * Function:  search_root_move
+ * --------------------
+ * Search one move of the computer ('x') with search_routine. With
+ * alpha_beta_routine every move gets the window (alpha, beta). Principal
+ * Variation Search searches the first move with it, and only proves with a
+ * null window that the other moves are not better than alpha, searching
+ * them again with (alpha, beta) if they are
+ *
+ *  board: The board configuration
+ *  cell: The move
+ *  depth: Depth of the iteration
+ *  alpha, beta: The window
+ *  is_first_move: Whether this is the first move searched
+ *  killer_move: The killer move (input and output)
+ *
+ *  returns: The value of the move, exact if it is inside the window
+ */
+int search_root_move(Bitboard *board, int cell, int depth, int alpha, int beta, int is_first_move, int *killer_move){
+	int value;
+	make_move(board, cell, 1);
+	if (search_routine == PRINCIPAL_VARIATION_SEARCH){
+		if (is_first_move){
+			value = -principal_variation_search(board, 1, depth, -beta, -alpha, 0, killer_move);
+		} else {
+			value = -principal_variation_search(board, 1, depth, -(alpha + 1), -alpha, 0, killer_move);
+			if ((value > alpha) && (value < beta) && (search_aborted == 0)){
+				value = -principal_variation_search(board, 1, depth, -beta, -alpha, 0, killer_move);
+			}
+		}
+	} else {
+		value = alpha_beta_routine(board, 1, depth, alpha, beta, 0, killer_move);
+	}
+	unmake_move(board, cell, 1);
+	return value;
+}
+
+/*
+ * Function:  parallel_search_root
+ * --------------------
+ * search_root with the moves handed out to num_of_threads threads, the
+ * calling thread being one of them. It gives the same best move and value
+ * as search_root when both are exact (without the transposition table,
+ * which the threads fill in another order)
+ *
+ *  board: The board configuration
+ *  move_list: The moves, best first
+ *  num_of_moves: Number of moves
+ *  depth: Depth of the iteration
+ *  alpha, beta: The window
+ *  best_move: Best move (output, as in search_root, but set to the first
+ *	move of the list when no move is better than alpha)
+ *
+ *  returns: The best value, as in search_root
+ */
+int parallel_search_root(const Bitboard *board, const int *move_list, int num_of_moves, int depth, int alpha,
+	int beta, int *best_move){
+	RootSearch root;
+	pthread_t workers[MAX_THREADS];
+	int num_of_workers, worker;
+	int best_id;
+
+	root.board = board;
+	root.move_list = move_list;
+	root.num_of_moves = num_of_moves;
+	root.depth = depth;
+	root.beta = beta;
+	memcpy(root.history, history_table, sizeof(history_table));
+	memcpy(root.countermoves, countermoves, sizeof(countermoves));
+	atomic_init(&root.next_move, 0);
+	atomic_init(&root.best, pack_root_best(alpha, num_of_moves, num_of_moves));
+	atomic_init(&root.max_value, ARBITRARILY_LOW_VALUE);
+	atomic_init(&root.aborted, 0);
+	atomic_init(&root.num_of_nodes, 0);
+
+	for (num_of_workers = 0; num_of_workers < num_of_threads - 1; num_of_workers++){
+		if (pthread_create(&workers[num_of_workers], NULL, root_worker, &root) != 0){
+			break;
+		}
+	}
+	search_root_moves(&root);
+	for (worker = 0; worker < num_of_workers; worker++){
+		pthread_join(workers[worker], NULL);
+	}
+
+	num_of_nodes += atomic_load(&root.num_of_nodes);
+	COUNT_STAT(collect_worker_stats());
+	if (atomic_load(&root.aborted)){
+		search_aborted = 1;
+	}
+	best_id = root_best_move_id(atomic_load(&root.best), num_of_moves);
+	if (best_id < num_of_moves){
+		*best_move = move_list[best_id];
+	} else {
+		/* No move beat alpha: keep the first one, the best of the previous iteration */
+		*best_move = move_list[0];
+	}
+	return atomic_load(&root.max_value);
+}
+
+/*
+ * Function:  root_worker
+ * --------------------
+ * Body of a worker thread of parallel_search_root
+ *
+ *  arg: The RootSearch
+ *
+ *  returns: NULL
+ */
+void *root_worker(void *arg){
+	RootSearch *root = (RootSearch *) arg;
+	memcpy(history_table, root->history, sizeof(history_table));
+	memcpy(countermoves, root->countermoves, sizeof(countermoves));
+	num_of_nodes = 0;
+	search_aborted = 0;
+	search_root_moves(root);
+	atomic_fetch_add(&root->num_of_nodes, num_of_nodes);
+	COUNT_STAT(merge_worker_stats());
+	return NULL;
+}
+
+/*
+ * Function:  search_root_moves
+ * --------------------
+ * Take moves from a RootSearch and search them until there are none left,
+ * a move fails high or the time is up
+ *
+ *  root: The RootSearch
+ *
+ *  returns: 0
+ */
+int search_root_moves(RootSearch *root){
+	Bitboard board = *root->board;
+	int killer_move = NO_MOVE;
+	int move_id, value, alpha, best_id, max_value;
+	long long best, packed;
+
+	while (1){
+		move_id = atomic_fetch_add(&root->next_move, 1);
+		if (move_id >= root->num_of_moves){
+			break;
+		}
+		best = atomic_load(&root->best);
+		alpha = root_best_value(best);
+		best_id = root_best_move_id(best, root->num_of_moves);
+		if (alpha >= root->beta){
+			break;
+		}
+		/* A move before the best one wins a tie, so it must be searched for one */
+		if ((best_id < root->num_of_moves) && (move_id < best_id)){
+			alpha--;
+		}
+		value = search_root_move(&board, root->move_list[move_id], root->depth, alpha, root->beta,
+			move_id == 0, &killer_move);
+		if (search_aborted){
+			atomic_store(&root->aborted, 1);
+			break;
+		}
+		max_value = atomic_load(&root->max_value);
+		while ((value > max_value) && !atomic_compare_exchange_weak(&root->max_value, &max_value, value)){
+		}
+		if (value <= alpha){
+			continue;
+		}
+		/* Raise the shared best to this move unless another thread proved better meanwhile */
+		packed = pack_root_best(value, move_id, root->num_of_moves);
+		best = atomic_load(&root->best);
+		while ((packed > best) && !atomic_compare_exchange_weak(&root->best, &best, packed)){
+		}
+		if (value >= root->beta){
+			/* No move needs to be handed out after a cutoff */
+			atomic_store(&root->next_move, root->num_of_moves);
+			break;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  pack_root_best
+ * --------------------
+ * Pack a value and the index of its move into one word, ordered by value
+ * and then by index, lower index first
+ *
+ *  value: The value
+ *  move_id: Index of the move in the move list, num_of_moves for none
+ *	(which loses to every move of the same value)
+ *  num_of_moves: Number of moves in the list
+ *
+ *  returns: (value - ARBITRARILY_LOW_VALUE) * 2^32 + num_of_moves - move_id
+ */
+long long pack_root_best(int value, int move_id, int num_of_moves){
+	return ((long long) (value - ARBITRARILY_LOW_VALUE) << 32) + (num_of_moves - move_id);
+}
+
+/*
+ * Function:  root_best_value
+ * --------------------
+ * Value packed by pack_root_best
+ *
+ *  best: The packed word
+ *
+ *  returns: The value
+ */
+int root_best_value(long long best){
+	return (int) (best >> 32) + ARBITRARILY_LOW_VALUE;
+}
+
+/*
+ * Function:  root_best_move_id
+ * --------------------
+ * Index of the move packed by pack_root_best
+ *
+ *  best: The packed word
+ *  num_of_moves: Number of moves in the list
+ *
+ *  returns: The index, or num_of_moves for none
+ */
+int root_best_move_id(long long best, int num_of_moves){
+	return num_of_moves - (int) (best & 0xffffffff);
+}
+
+/*
+ * Function:  start_helpers
+ * --------------------
+ * Start the num_of_threads - 1 workers of YOUNG_BROTHERS_WAIT_SEARCH or
+ * LAZY_SMP_SEARCH, each with a copy of the caller's history tables
+ * (nothing in the other modes)
+ *
+ *  board: The board configuration, searched by the Lazy SMP workers
+ *
+ *  returns: 0
+ */
+int start_helpers(const Bitboard *board){
+	int i;
+	if (((parallel_mode != YOUNG_BROTHERS_WAIT_SEARCH) && (parallel_mode != LAZY_SMP_SEARCH))
+		|| (num_of_threads < 2)){
+		return 0;
+	}
+	for (i = 0; i < num_of_threads; i++){
+		work_deques[i].top = 0;
+		work_deques[i].bottom = 0;
+	}
+	thread_id = 0;
+	current_split = NULL;
+	atomic_store(&helpers_must_stop, 0);
+	atomic_store(&helper_nodes, 0);
+	memcpy(helper_history, history_table, sizeof(history_table));
+	memcpy(helper_countermoves, countermoves, sizeof(countermoves));
+	helper_board = *board;
+	helpers_are_running = 1;
+	for (num_of_helpers = 0; num_of_helpers < num_of_threads - 1; num_of_helpers++){
+		helper_ids[num_of_helpers] = num_of_helpers + 1;
+		if (pthread_create(&helpers[num_of_helpers], NULL,
+			(parallel_mode == LAZY_SMP_SEARCH) ? lazy_helper : helper, &helper_ids[num_of_helpers]) != 0){
+			break;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  stop_helpers
+ * --------------------
+ * Stop the workers started by start_helpers and add their nodes to num_of_nodes
+ *
+ *  returns: 0
+ */
+int stop_helpers(void){
+	int i;
+	if (helpers_are_running == 0){
+		return 0;
+	}
+	pthread_mutex_lock(&idle_lock);
+	atomic_store(&helpers_must_stop, 1);
+	pthread_cond_broadcast(&work_available);
+	pthread_mutex_unlock(&idle_lock);
+	for (i = 0; i < num_of_helpers; i++){
+		pthread_join(helpers[i], NULL);
+	}
+	helpers_are_running = 0;
+	num_of_nodes += atomic_load(&helper_nodes);
+	COUNT_STAT(collect_worker_stats());
+	return 0;
+}
+
+/*
+ * Function:  helper
+ * --------------------
+ * Body of a worker of YOUNG_BROTHERS_WAIT_SEARCH: steal tasks until asked
+ * to stop, sleeping on work_available while there are none
+ *
+ *  arg: Pointer to the index of the thread in work_deques
+ *
+ *  returns: NULL
+ */
+void *helper(void *arg){
+	Task task;
+	long generation;
+	thread_id = *(const int *) arg;
+	memcpy(history_table, helper_history, sizeof(history_table));
+	memcpy(countermoves, helper_countermoves, sizeof(countermoves));
+	num_of_nodes = 0;
+	search_aborted = 0;
+	while (atomic_load(&helpers_must_stop) == 0){
+		/* Read before looking, so that tasks put on a deque after the look wake the thread up */
+		generation = atomic_load(&work_generation);
+		if (steal_task(&task)){
+			run_task(task);
+			continue;
+		}
+		pthread_mutex_lock(&idle_lock);
+		while ((atomic_load(&work_generation) == generation) && (atomic_load(&helpers_must_stop) == 0)){
+			pthread_cond_wait(&work_available, &idle_lock);
+		}
+		pthread_mutex_unlock(&idle_lock);
+	}
+	atomic_fetch_add(&helper_nodes, num_of_nodes);
+	COUNT_STAT(merge_worker_stats());
+	return NULL;
+}
+
+/*
+ * Function:  lazy_helper
+ * --------------------
+ * Body of a worker of LAZY_SMP_SEARCH: iterative deepening on its own copy
+ * of helper_board until asked to stop, a ply ahead of the calling thread
+ * for the workers of odd index
+ *
+ *  arg: Pointer to the index of the thread
+ *
+ *  returns: NULL
+ */
+void *lazy_helper(void *arg){
+	Bitboard board = helper_board;
+	int move_list[NUM_OF_CELLS];
+	int num_of_moves, depth;
+	int best_move = NO_MOVE;
+	thread_id = *(const int *) arg;
+	memcpy(history_table, helper_history, sizeof(history_table));
+	memcpy(countermoves, helper_countermoves, sizeof(countermoves));
+	num_of_nodes = 0;
+	search_aborted = 0;
+	num_of_moves = generate_moves(&board, 1, move_list);
+	for (depth = 1 + (thread_id & 1); (depth <= SEARCH_DEPTH) && (depth <= NUM_OF_CELLS - board.num_of_moves);
+		depth++){
+		prioritize_killer_move(best_move, move_list, num_of_moves);
+		search_root(&board, move_list, num_of_moves, depth, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE,
+			&best_move);
+		if (search_aborted){
+			break;
+		}
+	}
+	atomic_fetch_add(&helper_nodes, num_of_nodes);
+	COUNT_STAT(merge_worker_stats());
+	return NULL;
+}
+
+/*
+ * Function:  can_split
+ * --------------------
+ * Check whether a node of alpha_beta_routine may hand its younger brothers
+ * out to the workers
+ *
+ *  depth: Number of plies from the root
+ *  max_depth: Depth at which the evaluation function is applied
+ *  num_of_moves: Number of moves of the node
+ *
+ *  returns: 1 if it may and 0 otherwise
+ */
+int can_split(int depth, int max_depth, int num_of_moves){
+	WorkDeque *deque = &work_deques[thread_id];
+	int result;
+	if ((helpers_are_running == 0) || (parallel_mode != YOUNG_BROTHERS_WAIT_SEARCH) || (num_of_moves < 2)
+		|| (max_depth - depth < MIN_SPLIT_DRAFT)){
+		return 0;
+	}
+	pthread_mutex_lock(&deque->lock);
+	result = (deque->bottom + num_of_moves <= DEQUE_SIZE);
+	pthread_mutex_unlock(&deque->lock);
+	return result;
+}
+
+/*
+ * Function:  split_node
+ * --------------------
+ * Search the moves after the first one of a node of alpha_beta_routine or
+ * principal_variation_search as tasks of a split point: the calling thread
+ * searches the ones not stolen and sleeps until the others are finished.
+ * The window and the values are from the point of view of 'x', as in
+ * alpha_beta_routine
+ *
+ *  board: The board configuration
+ *  depth: Number of plies from the root
+ *  max_depth: Depth at which the evaluation function is applied
+ *  alpha, beta: The window after the first move
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *  move_list: The moves
+ *  num_of_moves: Number of moves
+ *  value: Value of the first move
+ *  best_move: Best move (input and output)
+ *  use_pvs: Whether the tasks run principal_variation_search
+ *
+ *  returns: The value of the node over all its moves, as in the serial loop
+ *	(meaningless if search_aborted is set)
+ */
+int split_node(const Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	const int *move_list, int num_of_moves, int value, int *best_move, int use_pvs){
+	SplitPoint split;
+	WorkDeque *deque = &work_deques[thread_id];
+	Task task;
+	int move_id;
+
+	split.parent = current_split;
+	split.board = board;
+	split.move_list = move_list;
+	split.depth = depth;
+	split.max_depth = max_depth;
+	split.is_maximizer = is_maximizer;
+	atomic_init(&split.stop, 0);
+	pthread_mutex_init(&split.lock, NULL);
+	split.alpha = alpha;
+	split.beta = beta;
+	split.value = value;
+	split.best_move = *best_move;
+	split.num_of_pending = num_of_moves - 1;
+	split.aborted = 0;
+	split.use_pvs = use_pvs;
+	pthread_cond_init(&split.done, NULL);
+
+	/* The last move at the top, so that the owner takes them in order from the bottom */
+	pthread_mutex_lock(&deque->lock);
+	for (move_id = num_of_moves - 1; move_id >= 1; move_id--){
+		deque->tasks[deque->bottom].split = &split;
+		deque->tasks[deque->bottom].move_id = move_id;
+		deque->bottom++;
+	}
+	pthread_mutex_unlock(&deque->lock);
+	pthread_mutex_lock(&idle_lock);
+	atomic_fetch_add(&work_generation, 1);
+	pthread_cond_broadcast(&work_available);
+	pthread_mutex_unlock(&idle_lock);
+
+	while (pop_task(&split, &task)){
+		run_task(task);
+	}
+	/* The tasks left were stolen */
+	pthread_mutex_lock(&split.lock);
+	while (split.num_of_pending > 0){
+		pthread_cond_wait(&split.done, &split.lock);
+	}
+	pthread_mutex_unlock(&split.lock);
+
+	pthread_cond_destroy(&split.done);
+	pthread_mutex_destroy(&split.lock);
+	if (split.aborted){
+		search_aborted = 1;
+		return 0;
+	}
+	/* A cutoff above this node makes its result useless */
+	if (split_is_cancelled()){
+		return 0;
+	}
+	*best_move = split.best_move;
+	return split.value;
+}
+
+/*
+ * Function:  run_task
+ * --------------------
+ * Search the move of a task with the current window of its split point and
+ * record the result. The moves of a principal_variation_search node are
+ * searched with the null window first, and again with the whole window if
+ * they turn out better
+ *
+ *  task: The task
+ *
+ *  returns: 0
+ */
+int run_task(Task task){
+	SplitPoint *split = task.split;
+	SplitPoint *saved_split = current_split;
+	Bitboard board;
+	int cell = split->move_list[task.move_id];
+	int alpha, beta, value, own_alpha, own_beta;
+	int killer_move = NO_MOVE;
+
+	if (atomic_load(&split->stop) == 0){
+		board = *split->board;
+		pthread_mutex_lock(&split->lock);
+		alpha = split->alpha;
+		beta = split->beta;
+		pthread_mutex_unlock(&split->lock);
+
+		current_split = split;
+		search_aborted = 0;
+		search_cancelled = 0;
+		COUNT_STAT(search_stats.searched_moves_at_ply[board.num_of_moves]++);
+		make_move(&board, cell, split->is_maximizer);
+		if (split->use_pvs){
+			/* The window of the player to move */
+			own_alpha = split->is_maximizer ? alpha : -beta;
+			own_beta = split->is_maximizer ? beta : -alpha;
+			value = -principal_variation_search(&board, split->depth + 1, split->max_depth, -own_alpha - 1, -own_alpha,
+				1 - split->is_maximizer, &killer_move);
+			if ((value > own_alpha) && (value < own_beta) && (search_aborted == 0)){
+				value = -principal_variation_search(&board, split->depth + 1, split->max_depth, -own_beta, -own_alpha,
+					1 - split->is_maximizer, &killer_move);
+			}
+			if (split->is_maximizer == 0){
+				value = -value;
+			}
+		} else {
+			value = alpha_beta_routine(&board, split->depth + 1, split->max_depth, alpha, beta,
+				1 - split->is_maximizer, &killer_move);
+		}
+		current_split = saved_split;
+
+		pthread_mutex_lock(&split->lock);
+		if (search_aborted && (search_cancelled == 0)){
+			/* Out of time: the whole split point is abandoned */
+			split->aborted = 1;
+			atomic_store(&split->stop, 1);
+		} else if (search_aborted == 0){
+			if (split->is_maximizer){
+				if (value > split->value){
+					split->value = value;
+					split->best_move = cell;
+				}
+				if (split->value > split->alpha){
+					split->alpha = split->value;
+				}
+			} else {
+				if (value < split->value){
+					split->value = value;
+					split->best_move = cell;
+				}
+				if (split->value < split->beta){
+					split->beta = split->value;
+				}
+			}
+			if (split->alpha >= split->beta){
+#ifdef SEARCH_STATS
+				/* Only the task that stops the split point caused the cutoff */
+				if (atomic_load(&split->stop) == 0){
+					record_cutoff(task.move_id);
+				}
+#endif
+				atomic_store(&split->stop, 1);
+			}
+		}
+		pthread_mutex_unlock(&split->lock);
+		search_aborted = 0;
+		search_cancelled = 0;
+	}
+
+	pthread_mutex_lock(&split->lock);
+	split->num_of_pending--;
+	if (split->num_of_pending == 0){
+		pthread_cond_signal(&split->done);
+	}
+	pthread_mutex_unlock(&split->lock);
+	return 0;
+}
+
+/*
+ * Function:  pop_task
+ * --------------------
+ * Take the newest task of the thread's own deque, if it belongs to the split point
+ *
+ *  split: The split point
+ *  task: The task (output)
+ *
+ *  returns: 1 if a task was taken and 0 otherwise
+ */
+int pop_task(const SplitPoint *split, Task *task){
+	WorkDeque *deque = &work_deques[thread_id];
+	int found = 0;
+	pthread_mutex_lock(&deque->lock);
+	if ((deque->bottom > deque->top) && (deque->tasks[deque->bottom - 1].split == split)){
+		deque->bottom--;
+		*task = deque->tasks[deque->bottom];
+		found = 1;
+	}
+	if (deque->bottom == deque->top){
+		deque->top = 0;
+		deque->bottom = 0;
+	}
+	pthread_mutex_unlock(&deque->lock);
+	return found;
+}
+
+/*
+ * Function:  steal_task
+ * --------------------
+ * Take the oldest task of the first other thread that has one
+ *
+ *  task: The task (output)
+ *
+ *  returns: 1 if a task was taken and 0 otherwise
+ */
+int steal_task(Task *task){
+	WorkDeque *deque;
+	int i, victim;
+	int found = 0;
+	for (i = 1; (i < num_of_threads) && (found == 0); i++){
+		victim = (thread_id + i) % num_of_threads;
+		deque = &work_deques[victim];
+		pthread_mutex_lock(&deque->lock);
+		if (deque->bottom > deque->top){
+			*task = deque->tasks[deque->top];
+			deque->top++;
+			found = 1;
+			if (deque->bottom == deque->top){
+				deque->top = 0;
+				deque->bottom = 0;
+			}
+		}
+		pthread_mutex_unlock(&deque->lock);
+	}
+	return found;
+}
+
+/*
+ * Function:  split_is_cancelled
+ * --------------------
+ * Check whether a split point above the current search has been stopped,
+ * and if so stop the search as well
+ *
+ *  returns: 1 if it has and 0 otherwise
+ */
+int split_is_cancelled(void){
+	const SplitPoint *split;
+	for (split = current_split; split != NULL; split = split->parent){
+		if (atomic_load_explicit(&split->stop, memory_order_acquire)){
+			search_aborted = 1;
+			search_cancelled = 1;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  mtdf
+ * --------------------
+ * MTD(f) for the computer ('x') to move: zero-window alpha_beta_routine
+ * searches around a guess, each one moving the lower or the upper bound of
+ * the value, until the bounds meet. It relies on the transposition table
+ * to keep the work of the earlier passes
+ *
+ *  board: The board configuration
+ *  first_guess: Estimate of the value
+ *  max_depth: Depth of the search
+ *  best_move: Best move, the one that proved the last lower bound (output,
+ *	unchanged if no pass failed high)
+ *
+ *  returns: The value of the position
+ */
+int mtdf(Bitboard *board, int first_guess, int max_depth, int *best_move){
+	int value = first_guess;
+	int lower = ARBITRARILY_LOW_VALUE, upper = ARBITRARILY_HIGH_VALUE;
+	int beta, killer_move, stored_value, table_move, symmetry;
+	uint64_t key;
+
+	while (lower < upper){
+		beta = (value == lower) ? value + 1 : value;
+		killer_move = NO_MOVE;
+		value = alpha_beta_routine(board, 0, max_depth, beta - 1, beta, 1, &killer_move);
+		num_of_passes++;
+		if (search_aborted){
+			return 0;
+		}
+		if (value < beta){
+			upper = value;
+		} else {
+			lower = value;
+			probe_transposition_table(board, 0, max_depth, beta - 1, beta, &stored_value, &table_move, &key, &symmetry);
+			if (table_move != NO_MOVE){
+				*best_move = table_move;
+			}
+		}
+	}
+	return value;
+}
+
+/*
+ * Function:  wall_clock
+ * --------------------
+ * Read the monotonic wall clock
+ *
+ *  returns: The time in seconds
+ */
+double wall_clock(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*
+ * Function:  time_is_up
+ * --------------------
+ * Check the deadline once every NODES_BETWEEN_TIME_CHECKS nodes, and set
+ * search_aborted once it has passed (or, in a worker, once the workers are
+ * asked to stop)
+ *
+ *  returns: 1 if the search must stop and 0 otherwise
+ */
+int time_is_up(void){
+	if (search_aborted){
+		return 1;
+	}
+	if ((num_of_nodes & (NODES_BETWEEN_TIME_CHECKS - 1)) != 0){
+		return 0;
+	}
+	if (((search_deadline > 0) && (wall_clock() >= search_deadline))
+		|| ((thread_id != 0) && atomic_load(&helpers_must_stop))){
+		search_aborted = 1;
+	}
+	return search_aborted;
+}
+
+/*
+ * Function:  perft
+ * --------------------
+ * Count the leaves of the game tree to a given depth: the positions depth
+ * moves ahead, and the games that end before. Nothing is evaluated, so
+ * this only measures (and checks) the move generation, make_move and
+ * unmake_move
+ *
+ *  board: The board configuration
+ *  depth: Number of moves still to be made
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *
+ *  returns: The number of leaves
+ */
+long perft(Bitboard *board, int depth, int is_maximizer){
+	int cell;
+	long num_of_leaves = 0;
+	if ((depth == 0) || (board->status != ONGOING)){
+		return 1;
+	}
+	for (cell = 0; cell < NUM_OF_CELLS; cell++){
+		if (is_empty(board, cell) == 0){
+			continue;
+		}
+		make_move(board, cell, is_maximizer);
+		num_of_leaves += perft(board, depth - 1, 1 - is_maximizer);
+		unmake_move(board, cell, is_maximizer);
+	}
+	return num_of_leaves;
+}
+
+/*
+ * Function:  min_max
+ * --------------------
+ * Exhaustive minimax search
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *
+ *  returns: The best possible score
+ */
+int min_max(Bitboard *board, int is_maximizer){
+	int cell;
+	int best_value;
+	int value;
+
+	num_of_nodes++;
+	COUNT_STAT(search_stats.nodes++);
+	COUNT_STAT(search_stats.terminal_positions += (board->status != ONGOING));
+	switch (board->status){
+		case X_WINS: return 10;
+		case O_WINS: return -10;
+		case DRAW: return 0;
+	}
+	COUNT_STAT(search_stats.expanded_at_ply[board->num_of_moves]++);
+	if (is_maximizer){
+		best_value = ARBITRARILY_LOW_VALUE;
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			if (is_empty(board, cell) == 0) {
+				continue;
+			}
+			COUNT_STAT(search_stats.legal_moves_at_ply[board->num_of_moves]++);
+			COUNT_STAT(search_stats.searched_moves_at_ply[board->num_of_moves]++);
+			make_move(board, cell, 1);
+			value = min_max(board, 0);
+			unmake_move(board, cell, 1);
+			if (value > best_value) {
+				best_value = value;
+			}
+		}
+	} else {
+		best_value = ARBITRARILY_HIGH_VALUE;
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			if (is_empty(board, cell) == 0) {
+				continue;
+			}
+			COUNT_STAT(search_stats.legal_moves_at_ply[board->num_of_moves]++);
+			COUNT_STAT(search_stats.searched_moves_at_ply[board->num_of_moves]++);
+			make_move(board, cell, 0);
+			value = min_max(board, 1);
+			unmake_move(board, cell, 0);
+			if (value < best_value) {
+				best_value = value;
+			}
+		}
+	}
+	return best_value;
+}
+
+/*
+ * Function:  alpha_beta_routine
+ * --------------------
+ * Alpha-beta search with the killer heuristic and a transposition table.
+ * Moves are tried in the order of generate_moves (centre, corners, middle of
+ * edges on 3x3), with the best move stored in the transposition table first
+ * and the last refutation found next
+ *
+ *  board: The board configuration
+ *  depth: Number of plies from the root
+ *  max_depth: Depth at which the evaluation function is applied
+ *  alpha: Best value the maximizer is already assured of
+ *  beta: Best value the minimizer is already assured of
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *  killer_move: The last move that caused a cutoff, or NO_MOVE (input and output)
+ *
+ *  returns: The value of the position
+ */
+int alpha_beta_routine(Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	int *killer_move){
+	int cell;
+	int value, temp;
+	int move_list[NUM_OF_CELLS];
+	int move_id, num_of_moves;
+	int best_move = NO_MOVE;
+	int table_move = NO_MOVE;
+	int stored_value, bound;
+	int original_alpha = alpha, original_beta = beta;
+	int symmetry = 0;
+	uint64_t key = 0;
+
+	num_of_nodes++;
+	COUNT_STAT(search_stats.nodes++);
+	if (time_is_up() || split_is_cancelled()){
+		return 0;
+	}
+	COUNT_STAT(search_stats.terminal_positions += (board->status != ONGOING));
+	switch (board->status){
+		case X_WINS: return WIN_VALUE - depth;
+		case O_WINS: return -(WIN_VALUE - depth);
+		case DRAW: return 0;
+	}
+	if (depth == max_depth){
+		COUNT_STAT(search_stats.leaf_evaluations++);
+		return evaluation_function(board);
+	}
+
+	if (use_transposition_table && probe_transposition_table(board, depth, max_depth - depth, alpha, beta,
+		&stored_value, &table_move, &key, &symmetry)){
+		return stored_value;
+	}
+
+	num_of_moves = generate_moves(board, is_maximizer, move_list);
+	order_moves(board, is_maximizer, *killer_move, table_move, move_list, num_of_moves);
+	COUNT_STAT(search_stats.expanded_at_ply[board->num_of_moves]++);
+	COUNT_STAT(search_stats.legal_moves_at_ply[board->num_of_moves] += num_of_moves);
+	if (is_maximizer){
+		value = ARBITRARILY_LOW_VALUE;
+		for (move_id = 0; move_id < num_of_moves; move_id++){
+			cell = move_list[move_id];
+			COUNT_STAT(search_stats.searched_moves_at_ply[board->num_of_moves]++);
+			make_move(board, cell, 1);
+			temp = alpha_beta_routine(board, depth+1, max_depth, alpha, beta, 0, killer_move);
+			unmake_move(board, cell, 1);
+			if (search_aborted){
+				return 0;
+			}
+			if (temp > value){
+				value = temp;
+				best_move = cell;
+			}
+			if (value >= beta){
+				COUNT_STAT(record_cutoff(move_id));
+				*killer_move = cell;
+				update_history(board, 1, cell, max_depth - depth);
+				bound = LOWER_BOUND;
+				goto THE_END;
+			}
+			if (value > alpha){
+				alpha = value;
+			}
+			/* The eldest brother did not cut off: the others may be searched in parallel */
+			if ((move_id == 0) && can_split(depth, max_depth, num_of_moves)){
+				value = split_node(board, depth, max_depth, alpha, beta, 1, move_list, num_of_moves, value, &best_move,
+					0);
+				if (search_aborted){
+					return 0;
+				}
+				if (value >= beta){
+					*killer_move = best_move;
+					update_history(board, 1, best_move, max_depth - depth);
+					bound = LOWER_BOUND;
+					goto THE_END;
+				}
+				break;
+			}
+		}
+	} else {
+		value = ARBITRARILY_HIGH_VALUE;
+		for (move_id = 0; move_id < num_of_moves; move_id++){
+			cell = move_list[move_id];
+			COUNT_STAT(search_stats.searched_moves_at_ply[board->num_of_moves]++);
+			make_move(board, cell, 0);
+			temp = alpha_beta_routine(board, depth+1, max_depth, alpha, beta, 1, killer_move);
+			unmake_move(board, cell, 0);
+			if (search_aborted){
+				return 0;
+			}
+			if (temp < value){
+				value = temp;
+				best_move = cell;
+			}
+			if (value <= alpha){
+				COUNT_STAT(record_cutoff(move_id));
+				*killer_move = cell;
+				update_history(board, 0, cell, max_depth - depth);
+				bound = UPPER_BOUND;
+				goto THE_END;
+			}
+			if (value < beta){
+				beta = value;
+			}
+			if ((move_id == 0) && can_split(depth, max_depth, num_of_moves)){
+				value = split_node(board, depth, max_depth, alpha, beta, 0, move_list, num_of_moves, value, &best_move,
+					0);
+				if (search_aborted){
+					return 0;
+				}
+				if (value <= alpha){
+					*killer_move = best_move;
+					update_history(board, 0, best_move, max_depth - depth);
+					bound = UPPER_BOUND;
+					goto THE_END;
+				}
+				break;
+			}
+		}
+	}
+	/* No killer move */
+	*killer_move = NO_MOVE;
+	if (value <= original_alpha){
+		bound = UPPER_BOUND;
+	} else if (value >= original_beta){
+		bound = LOWER_BOUND;
+	} else {
+		bound = EXACT_BOUND;
+	}
+
+	THE_END:
+	if (use_transposition_table){
+		store_transposition_entry(key, depth, max_depth - depth, value, bound,
+			(best_move == NO_MOVE) ? NO_MOVE : symmetry_map[symmetry][best_move]);
+	}
+	return value;
+}
+
+#ifdef SEARCH_STATS
+/*
+ * Function:  record_cutoff
+ * --------------------
+ * Count a cutoff in search_stats
+ *
+ *  move_id: Index in the move list of the move that caused it
+ *
+ *  returns: 0
+ */
+int record_cutoff(int move_id){
+	search_stats.cutoffs++;
+	search_stats.cutoffs_by_move[move_id]++;
+	return 0;
+}
+
+/*
+ * Function:  add_search_stats
+ * --------------------
+ * Add every counter of a SearchStats to another one
+ *
+ *  total: The SearchStats added to
+ *  stats: The SearchStats added
+ *
+ *  returns: 0
+ */
+int add_search_stats(SearchStats *total, const SearchStats *stats){
+	int i;
+	total->nodes += stats->nodes;
+	total->leaf_evaluations += stats->leaf_evaluations;
+	total->terminal_positions += stats->terminal_positions;
+	total->cutoffs += stats->cutoffs;
+	for (i = 0; i < NUM_OF_CELLS; i++){
+		total->cutoffs_by_move[i] += stats->cutoffs_by_move[i];
+	}
+	total->table_probes += stats->table_probes;
+	total->table_hits += stats->table_hits;
+	total->table_cutoffs += stats->table_cutoffs;
+	for (i = 0; i <= NUM_OF_CELLS; i++){
+		total->expanded_at_ply[i] += stats->expanded_at_ply[i];
+		total->legal_moves_at_ply[i] += stats->legal_moves_at_ply[i];
+		total->searched_moves_at_ply[i] += stats->searched_moves_at_ply[i];
+	}
+	return 0;
+}
+
+/*
+ * Function:  merge_worker_stats
+ * --------------------
+ * Add the statistics of a worker thread to worker_stats, before it ends
+ *
+ *  returns: 0
+ */
+int merge_worker_stats(void){
+	pthread_mutex_lock(&worker_stats_lock);
+	add_search_stats(&worker_stats, &search_stats);
+	pthread_mutex_unlock(&worker_stats_lock);
+	return 0;
+}
+
+/*
+ * Function:  collect_worker_stats
+ * --------------------
+ * Add worker_stats to the statistics of the calling thread, once the
+ * workers are joined, and clear it
+ *
+ *  returns: 0
+ */
+int collect_worker_stats(void){
+	pthread_mutex_lock(&worker_stats_lock);
+	add_search_stats(&search_stats, &worker_stats);
+	memset(&worker_stats, 0, sizeof(worker_stats));
+	pthread_mutex_unlock(&worker_stats_lock);
+	return 0;
+}
+
+/*
+ * Function:  print_search_stats
+ * --------------------
+ * Print the counters of a SearchStats: the share of the cutoffs caused by
+ * the first move (how good the move ordering is), the share of the table
+ * probes that found the position or answered the search, and for each
+ * ply (number of moves made) the nodes expanded with their average number
+ * of legal moves and of moves searched (the effective branching factor)
+ *
+ *  stats: The SearchStats
+ *  title: What they were counted over
+ *
+ *  returns: 0
+ */
+int print_search_stats(const SearchStats *stats, const char *title){
+	int i, last;
+	printf("Search statistics of %s:\n", title);
+	printf("  nodes: %ld, leaf evaluations: %ld, terminal positions: %ld\n", stats->nodes,
+		stats->leaf_evaluations, stats->terminal_positions);
+	printf("  cutoffs: %ld", stats->cutoffs);
+	if (stats->cutoffs > 0){
+		printf(", by the first move: %.1f%%, by move:", 100.0 * stats->cutoffs_by_move[0] / stats->cutoffs);
+		last = NUM_OF_CELLS - 1;
+		while (stats->cutoffs_by_move[last] == 0){
+			last--;
+		}
+		for (i = 0; i <= last; i++){
+			printf(" %ld", stats->cutoffs_by_move[i]);
+		}
+	}
+	printf("\n");
+	printf("  table probes: %ld", stats->table_probes);
+	if (stats->table_probes > 0){
+		printf(", hits: %.1f%%, cutoffs: %.1f%%", 100.0 * stats->table_hits / stats->table_probes,
+			100.0 * stats->table_cutoffs / stats->table_probes);
+	}
+	printf("\n");
+	printf("  %4s %12s %12s %12s\n", "ply", "expanded", "legal moves", "searched");
+	for (i = 0; i <= NUM_OF_CELLS; i++){
+		if (stats->expanded_at_ply[i] > 0){
+			printf("  %4d %12ld %12.2f %12.2f\n", i, stats->expanded_at_ply[i],
+				(double) stats->legal_moves_at_ply[i] / stats->expanded_at_ply[i],
+				(double) stats->searched_moves_at_ply[i] / stats->expanded_at_ply[i]);
+		}
+	}
+	return 0;
+}
+#endif
+
+/*
+ * Function:  prioritize_killer_move
+ * --------------------
+ * Swap the killer move to the front of the move list, if it is in the list
+ *
+ *  killer_move: The killer move
+ *  move_list: List of moves to be searched
+ *  num_of_moves: Number of moves in the list
+ *
+ *  returns: 0
+ */
+int prioritize_killer_move(int killer_move, int *move_list, int num_of_moves){
+	int move_id;
+	int temp;
+	for (move_id = 0; move_id < num_of_moves; move_id++){
+		if (killer_move == move_list[move_id]){
+			break;
+		}
+	}
+	if (move_id == num_of_moves){
+		return 0;
+	}
+	temp = move_list[move_id];
+	move_list[move_id] = move_list[0];
+	move_list[0] = temp;
+	return 0;
+}
+
+/*
+ * Function:  order_moves
+ * --------------------
+ * Sort the move list for the search: the best move from the transposition
+ * table, the killer move and the countermove of the opponent's last move
+ * first, then the other moves by history score plus RANK_WEIGHT per place
+ * from the end of the list of generate_moves, so that a move is only moved
+ * up once its history score outweighs the static order. Without use_history_heuristic only the
+ * table move and the killer move are brought to the front
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *  killer_move: The killer move, or NO_MOVE
+ *  table_move: The best move from the transposition table, or NO_MOVE
+ *  move_list: The moves (input and output)
+ *  num_of_moves: Number of moves
+ *
+ *  returns: 0
+ */
+int order_moves(const Bitboard *board, int is_maximizer, int killer_move, int table_move, int *move_list,
+	int num_of_moves){
+	int scores[NUM_OF_CELLS];
+	int move_id, i, cell, score;
+	int countermove = NO_MOVE;
+
+	if (use_history_heuristic == 0){
+		if (killer_move != NO_MOVE){
+			prioritize_killer_move(killer_move, move_list, num_of_moves);
+		}
+		/* The best move from the transposition table goes before the killer move */
+		if (table_move != NO_MOVE){
+			prioritize_killer_move(table_move, move_list, num_of_moves);
+		}
+		return 0;
+	}
+	if (board->num_of_moves > 0){
+		countermove = countermoves[is_maximizer][board->moves[board->num_of_moves - 1]];
+	}
+	for (move_id = 0; move_id < num_of_moves; move_id++){
+		cell = move_list[move_id];
+		if (cell == table_move){
+			score = 1 << 30;
+		} else if (cell == killer_move){
+			score = 1 << 29;
+		} else if (cell == countermove){
+			score = 1 << 28;
+		} else {
+			score = history_table[is_maximizer][cell] + (num_of_moves - move_id) * RANK_WEIGHT;
+		}
+		for (i = move_id; (i > 0) && (scores[i-1] < score); i--){
+			move_list[i] = move_list[i-1];
+			scores[i] = scores[i-1];
+		}
+		move_list[i] = cell;
+		scores[i] = score;
+	}
+	return 0;
+}
+
+/*
+ * Function:  update_history
+ * --------------------
+ * Reward a move that caused a cutoff: add draft^2 to its history score and
+ * make it the countermove of the opponent's last move
+ *
+ *  board: The board configuration, before the move
+ *  is_maximizer: Whether the move was made by the maximizer ('x')
+ *  cell: The move
+ *  draft: Number of plies searched below the node
+ *
+ *  returns: 0
+ */
+int update_history(const Bitboard *board, int is_maximizer, int cell, int draft){
+	history_table[is_maximizer][cell] += draft * draft;
+	/* Keep the scores below the countermove score */
+	if (history_table[is_maximizer][cell] >= (1 << 27)){
+		age_history_tables();
+	}
+	if (board->num_of_moves > 0){
+		countermoves[is_maximizer][board->moves[board->num_of_moves - 1]] = cell;
+	}
+	return 0;
+}
+
+/*
+ * Function:  clear_history_tables
+ * --------------------
+ * Reset the history scores and remove the countermoves
+ *
+ *  returns: 0
+ */
+int clear_history_tables(void){
+	int player, cell;
+	for (player = 0; player < 2; player++){
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			history_table[player][cell] = 0;
+			countermoves[player][cell] = NO_MOVE;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  age_history_tables
+ * --------------------
+ * Halve the history scores, so that recent searches count more
+ *
+ *  returns: 0
+ */
+int age_history_tables(void){
+	int player, cell;
+	for (player = 0; player < 2; player++){
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			history_table[player][cell] /= 2;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  negate_bound
+ * --------------------
+ * Bound type of -value when value has the given bound type
+ *
+ *  bound: EXACT_BOUND, LOWER_BOUND or UPPER_BOUND
+ *
+ *  returns: The bound type of the negated value
+ */
+int negate_bound(int bound){
+	switch (bound){
+		case LOWER_BOUND: return UPPER_BOUND;
+		case UPPER_BOUND: return LOWER_BOUND;
+		default: return bound;
+	}
+}
+
+/*
+ * Function:  principal_variation_search
+ * --------------------
+ * Principal Variation Search (NegaScout) in negamax form, with the killer
+ * heuristic and the transposition table. The first move is searched with
+ * the full window; every other move is searched with the null window
+ * (alpha, alpha + 1) and only searched again with (alpha, beta) if it
+ * turns out to be better than alpha. The transposition table holds values
+ * from the point of view of 'x', as for alpha_beta_routine
+ *
+ *  board: The board configuration
+ *  depth: Number of plies from the root
+ *  max_depth: Depth at which the evaluation function is applied
+ *  alpha: Best value the player to move is already assured of
+ *  beta: Best value the opponent is already assured of, negated
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *  killer_move: The last move that caused a cutoff, or NO_MOVE (input and output)
+ *
+ *  returns: The value of the position for the player to move
+ */
+int principal_variation_search(Bitboard *board, int depth, int max_depth, int alpha, int beta, int is_maximizer,
+	int *killer_move){
+	int cell;
+	int value, temp;
+	int move_list[NUM_OF_CELLS];
+	int move_id, num_of_moves;
+	int best_move = NO_MOVE;
+	int table_move = NO_MOVE;
+	int stored_value, bound;
+	int original_alpha = alpha;
+	int sign = is_maximizer ? 1 : -1;
+	int symmetry = 0;
+	uint64_t key = 0;
+
+	num_of_nodes++;
+	if (time_is_up() || split_is_cancelled()){
+		return 0;
+	}
+	switch (board->status){
+		case X_WINS: return sign * (WIN_VALUE - depth);
+		case O_WINS: return -sign * (WIN_VALUE - depth);
+		case DRAW: return 0;
+	}
+	if (depth == max_depth){
+		return sign * evaluation_function(board);
+	}
+
+	if (use_transposition_table && probe_transposition_table(board, depth, max_depth - depth,
+		is_maximizer ? alpha : -beta, is_maximizer ? beta : -alpha, &stored_value, &table_move, &key, &symmetry)){
+		return sign * stored_value;
+	}
+
+	num_of_moves = generate_moves(board, is_maximizer, move_list);
+	order_moves(board, is_maximizer, *killer_move, table_move, move_list, num_of_moves);
+	value = ARBITRARILY_LOW_VALUE;
+	bound = UPPER_BOUND;
+	for (move_id = 0; move_id < num_of_moves; move_id++){
+		cell = move_list[move_id];
+		make_move(board, cell, is_maximizer);
+		if (move_id == 0){
+			temp = -principal_variation_search(board, depth+1, max_depth, -beta, -alpha, 1 - is_maximizer,
+				killer_move);
+		} else {
+			temp = -principal_variation_search(board, depth+1, max_depth, -alpha - 1, -alpha, 1 - is_maximizer,
+				killer_move);
+			if ((temp > alpha) && (temp < beta) && (search_aborted == 0)){
+				temp = -principal_variation_search(board, depth+1, max_depth, -beta, -alpha, 1 - is_maximizer,
+					killer_move);
+			}
+		}
+		unmake_move(board, cell, is_maximizer);
+		if (search_aborted){
+			return 0;
+		}
+		if (temp > value){
+			value = temp;
+			best_move = cell;
+		}
+		if (value >= beta){
+			*killer_move = cell;
+			update_history(board, is_maximizer, cell, max_depth - depth);
+			bound = LOWER_BOUND;
+			goto THE_END;
+		}
+		if (value > alpha){
+			alpha = value;
+		}
+		/* The eldest brother did not cut off: the others may be searched in parallel (split_node works for 'x') */
+		if ((move_id == 0) && can_split(depth, max_depth, num_of_moves)){
+			temp = split_node(board, depth, max_depth, is_maximizer ? alpha : -beta, is_maximizer ? beta : -alpha,
+				is_maximizer, move_list, num_of_moves, sign * value, &best_move, 1);
+			if (search_aborted){
+				return 0;
+			}
+			value = sign * temp;
+			if (value >= beta){
+				*killer_move = best_move;
+				update_history(board, is_maximizer, best_move, max_depth - depth);
+				bound = LOWER_BOUND;
+				goto THE_END;
+			}
+			break;
+		}
+	}
+	/* No killer move */
+	*killer_move = NO_MOVE;
+	if (value > original_alpha){
+		bound = EXACT_BOUND;
+	}
+
+	THE_END:
+	if (use_transposition_table){
+		store_transposition_entry(key, depth, max_depth - depth, sign * value,
+			is_maximizer ? bound : negate_bound(bound),
+			(best_move == NO_MOVE) ? NO_MOVE : symmetry_map[symmetry][best_move]);
+	}
+	return value;
+}
+
+/*
+ * Function:  search
+ * --------------------
+ * Depth-limited minimax using the heuristic evaluation function at the leaves
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the current player is the maximizer ('x')
+ *  depth: Current depth
+ *  max_depth: Depth at which the evaluation function is applied
+ *
+ *  returns: The value of the position
+ */
+int search(Bitboard *board, int is_maximizer, int depth, int max_depth){
+	int cell;
+	int value, best_value;
+
+	num_of_nodes++;
+	switch (board->status){
+		case X_WINS: return ARBITRARILY_HIGH_VALUE;
+		case O_WINS: return ARBITRARILY_LOW_VALUE;
+		case DRAW: return 0;
+	}
+
+	if (is_maximizer == 1){
+		best_value = ARBITRARILY_LOW_VALUE;
+	} else {
+		best_value = ARBITRARILY_HIGH_VALUE;
+	}
+
+	for (cell = 0; cell < NUM_OF_CELLS; cell++){
+		if (is_empty(board, cell) == 0) {
+			continue;
+		}
+		make_move(board, cell, is_maximizer);
+		if (depth == max_depth){
+			num_of_nodes++;
+			value = evaluation_function(board);
+		} else {
+			value = search(board, 1 - is_maximizer, depth + 1, max_depth);
+		}
+		unmake_move(board, cell, is_maximizer);
+
+		if (is_maximizer == 1){
+			if (best_value < value){
+				best_value = value;
+			}
+		} else {
+			if (best_value > value){
+				best_value = value;
+			}
+		}
+	}
+
+	return best_value;
+}
+
+/*
+ * Function:  evaluation_function
+ * --------------------
+ * Heuristic value of the board: 1230*c3 - 63*n2 + 31*c2, where c3 counts the
+ * BOARD_K-rows of 'x' and n2, c2 the (BOARD_K - 1)-rows of 'o' and 'x'. It
+ * is kept up to date by make_move and unmake_move, or looked up by the
+ * base-3 index on small boards
+ *
+ *  board: The board configuration
+ *
+ *  returns: The heuristic value
+ */
+int evaluation_function(const Bitboard *board){
+#ifdef USE_TERMINAL_STATUS_TABLE
+	return heuristic_values[board->index];
+#else
+	return board->score;
+#endif
+}
+
+/*
+ * Function:  generate_moves
+ * --------------------
+ * List the moves to search. Up to 64 cells these are all the empty cells in
+ * the order of ordered_moves. On larger boards only the empty cells at most
+ * 2 steps away from a symbol are kept; each one is scored by the lines it
+ * extends for the player and blocks for the opponent, and the best
+ * MAX_CANDIDATES are returned, best first
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *  move_list: The moves (output)
+ *
+ *  returns: The number of moves
+ */
+int generate_moves(const Bitboard *board, int is_maximizer, int *move_list){
+	int num_of_moves = 0;
+#ifndef USE_NEIGHBOURHOOD_MOVES
+	int move_id;
+	(void) is_maximizer;
+	for (move_id = 0; move_id < NUM_OF_CELLS; move_id++){
+		if (is_empty(board, ordered_moves[move_id])){
+			move_list[num_of_moves++] = ordered_moves[move_id];
+		}
+	}
+#else
+	int i, k, cell, line, own, other, step;
+	int move_val[NUM_OF_CELLS];
+	int value;
+	Mask occupied, near, left, right;
+	const unsigned char *own_count = is_maximizer ? board->num_of_x : board->num_of_o;
+	const unsigned char *other_count = is_maximizer ? board->num_of_o : board->num_of_x;
+
+	occupied = mask_or(board->x, board->o);
+	if (mask_is_empty(occupied)){
+		move_list[0] = CELL(BOARD_M / 2, BOARD_N / 2);
+		return 1;
+	}
+	/* Grow the occupied cells by one step in the 8 directions, twice */
+	near = occupied;
+	for (step = 0; step < 2; step++){
+		left = mask_and(mask_shift(near, -1), not_last_col);
+		right = mask_and(mask_shift(near, 1), not_first_col);
+		near = mask_or(near, mask_or(left, right));
+		near = mask_or(near, mask_or(mask_shift(near, BOARD_N), mask_shift(near, -BOARD_N)));
+	}
+	near = mask_and_not(near, occupied);
+
+	while (mask_is_empty(near) == 0){
+		cell = mask_first_cell(near);
+		CLEAR_BIT(near, cell);
+		value = 0;
+		for (k = 0; k < num_of_cell_lines[cell]; k++){
+			line = cell_lines[cell][k];
+			own = own_count[line];
+			other = other_count[line];
+			if (other == 0){
+				value += x_row_weight[own + 1];
+			}
+			if (own == 0){
+				value += x_row_weight[other + 1];
+			}
+		}
+		for (i = num_of_moves; (i > 0) && (move_val[i-1] < value); i--){
+			move_list[i] = move_list[i-1];
+			move_val[i] = move_val[i-1];
+		}
+		move_list[i] = cell;
+		move_val[i] = value;
+		num_of_moves++;
+	}
+	if (num_of_moves > MAX_CANDIDATES){
+		num_of_moves = MAX_CANDIDATES;
+	}
+#endif
+	return num_of_moves;
+}
+
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+
+/*
+	The routines below are the char board[3][3] versions of min_max,
+	alpha_beta_routine and search, kept only as the baseline for run_benchmark
+*/
+
+int char_board_min_max(char board[3][3], int is_maximizer){
+	int i,j;
+	int best_value;
+	int value;
+
+	num_of_nodes++;
+	if (char_board_is_victorious((const char (*)[3]) board, 'o')){
+		return -10;
+	}
+	if (char_board_is_victorious((const char (*)[3]) board, 'x')){
+		return 10;
+	}
+	if (char_board_is_draw((const char (*)[3]) board)){
+		return 0;
+	}
+	if (is_maximizer) {
+		best_value = ARBITRARILY_LOW_VALUE;
+		for (i = 0; i < 3; i++){
+			for (j = 0; j < 3; j++) {
+				if (board[i][j] != '_') {
+					continue;
+				}
+				board[i][j] = 'x';
+				value = char_board_min_max(board, 0);
+				board[i][j] = '_';
+				if (value > best_value) {
+					best_value = value;
+				}
+			}
+		}
+	} else {
+		best_value = ARBITRARILY_HIGH_VALUE;
+		for (i = 0; i < 3; i++){
+			for (j = 0; j < 3; j++) {
+				if (board[i][j] != '_') {
+					continue;
+				}
+				board[i][j] = 'o';
+				value = char_board_min_max(board, 1);
+				board[i][j] = '_';
+				if (value < best_value) {
+					best_value = value;
+				}
+			}
+		}
+	}
+	return best_value;
+}
+
+int char_board_alpha_beta_routine(char board[3][3], int depth, int alpha, int beta, int is_maximizer, int *killer_move){
+	int i,j;
+	int value, temp;
+	int move_list[NUM_OF_CELLS];
+	int move_id, num_of_moves;
+
+	num_of_nodes++;
+	if (char_board_is_victorious((const char (*)[3]) board, 'x')){
+		return WIN_VALUE - depth;
+	}
+	if (char_board_is_victorious((const char (*)[3]) board, 'o')){
+		return -(WIN_VALUE - depth);
+	}
+	if (char_board_is_draw((const char (*)[3]) board)){
+		return 0;
+	}
+
+	num_of_moves = 0;
+	for (move_id = 0; move_id < NUM_OF_CELLS; move_id++){
+		if (board[ordered_moves[move_id] / 3][ordered_moves[move_id] % 3] == '_'){
+			move_list[num_of_moves++] = ordered_moves[move_id];
+		}
+	}
+	if (*killer_move != NO_MOVE){
+		prioritize_killer_move(*killer_move, move_list, num_of_moves);
+	}
+	if (is_maximizer){
+		value = ARBITRARILY_LOW_VALUE;
+		for (move_id = 0; move_id < num_of_moves; move_id++){
+			i = move_list[move_id] / 3;
+			j = move_list[move_id] % 3;
+			board[i][j] = 'x';
+			temp = char_board_alpha_beta_routine(board, depth+1, alpha, beta, 0, killer_move);
+			board[i][j] = '_';
+			if (temp > value){
+				value = temp;
+			}
+			if (value > alpha){
+				alpha = value;
+			}
+			if (alpha >= beta){
+				*killer_move = move_list[move_id];
+				goto THE_END;
+			}
+		}
+	} else {
+		value = ARBITRARILY_HIGH_VALUE;
+		for (move_id = 0; move_id < num_of_moves; move_id++){
+			i = move_list[move_id] / 3;
+			j = move_list[move_id] % 3;
+			board[i][j] = 'o';
+			temp = char_board_alpha_beta_routine(board, depth+1, alpha, beta, 1, killer_move);
+			board[i][j] = '_';
+			if (temp < value){
+				value = temp;
+			}
+			if (value < beta){
+				beta = value;
+			}
+			if (alpha >= beta){
+				*killer_move = move_list[move_id];
+				goto THE_END;
+			}
+		}
+	}
+	/* No killer move */
+	*killer_move = NO_MOVE;
+
+	THE_END: return value;
+}
+
+int char_board_search(char board[3][3], int is_maximizer, int depth, int max_depth){
+	int i, j;
+	int value, best_value;
+
+	num_of_nodes++;
+	if (char_board_is_victorious((const char (*)[3]) board, 'x')){
+		return ARBITRARILY_HIGH_VALUE;
+	}
+	if (char_board_is_victorious((const char (*)[3]) board, 'o')){
+		return ARBITRARILY_LOW_VALUE;
+	}
+	if (char_board_is_draw((const char (*)[3]) board)){
+		return 0;
+	}
+
+	if (is_maximizer == 1){
+		best_value = ARBITRARILY_LOW_VALUE;
+	} else {
+		best_value = ARBITRARILY_HIGH_VALUE;
+	}
+
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++) {
+			if (board[i][j] != '_') {
+				continue;
+			}
+			if (is_maximizer){
+				board[i][j] = 'x';
+			} else {
+				board[i][j] = 'o';
+			}
+			if (depth == max_depth){
+				num_of_nodes++;
+				value = char_board_evaluation_function((const char (*)[3]) board);
+			} else {
+				value = char_board_search(board, 1 - is_maximizer, depth + 1, max_depth);
+			}
+			board[i][j] = '_';
+
+			if (is_maximizer == 1){
+				if (best_value < value){
+					best_value = value;
+				}
+			} else {
+				if (best_value > value){
+					best_value = value;
+				}
+			}
+		}
+	}
+
+	return best_value;
+}
+
+int char_board_is_victorious(const char board[3][3], char player){
+	int i,j;
+	for (i = 0; i < 3; i++){
+		if ((board[i][0] == player) && (board[i][1] == player) && (board[i][2] == player)) {
+			return 1;
+		}
+	}
+	for (j = 0; j < 3; j++){
+		if ((board[0][j] == player) && (board[1][j] == player) && (board[2][j] == player)) {
+			return 1;
+		}
+	}
+	if ((board[0][0] == player) && (board[1][1] == player) && (board[2][2] == player)) {
+		return 1;
+	}
+	if ((board[0][2] == player) && (board[1][1] == player) && (board[2][0] == player)) {
+		return 1;
+	}
+	return 0;
+}
+
+int char_board_is_draw(const char board[3][3]){
+	int i,j;
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++){
+			if (board[i][j] == '_'){
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+int char_board_evaluation_function(const char board[3][3]){
+	static const int lines[8][3] = {
+		{0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+		{0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+		{0, 4, 8}, {2, 4, 6}
+	};
+	int line, k;
+	int num_of_x, num_of_o, num_of_empty_spaces;
+	int c3 = 0, n2 = 0, c2 = 0;
+	for (line = 0; line < 8; line++){
+		num_of_x = 0;
+		num_of_o = 0;
+		num_of_empty_spaces = 0;
+		for (k = 0; k < 3; k++){
+			switch (board[lines[line][k] / 3][lines[line][k] % 3]){
+				case 'x': num_of_x++; break;
+				case 'o': num_of_o++; break;
+				default: num_of_empty_spaces++; break;
+			}
+		}
+		if (num_of_x == 3){
+			c3++;
+		}
+		if ((num_of_o == 2) && (num_of_empty_spaces == 1)){
+			n2++;
+		}
+		if ((num_of_x == 2) && (num_of_empty_spaces == 1)){
+			c2++;
+		}
+	}
+	return 1230*c3 - 63*n2 + 31*c2;
+}
+
+long char_board_perft(char board[3][3], int depth, int is_maximizer){
+	int i,j;
+	long num_of_leaves = 0;
+	if ((depth == 0) || char_board_is_victorious((const char (*)[3]) board, 'x')
+		|| char_board_is_victorious((const char (*)[3]) board, 'o') || char_board_is_draw((const char (*)[3]) board)){
+		return 1;
+	}
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++){
+			if (board[i][j] != '_'){
+				continue;
+			}
+			board[i][j] = is_maximizer ? 'x' : 'o';
+			num_of_leaves += char_board_perft(board, depth - 1, 1 - is_maximizer);
+			board[i][j] = '_';
+		}
+	}
+	return num_of_leaves;
+}
+#endif
+
+/*
+ * Function:  seed_random
+ * --------------------
+ * Seed the random number generator of the calling thread, scrambling the
+ * seed (splitmix64) so that close seeds give unrelated sequences
+ *
+ *  seed: The seed
+ *
+ *  returns: 0
+ */
+int seed_random(uint64_t seed){
+	seed += 0x9E3779B97F4A7C15ULL;
+	seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+	seed ^= seed >> 31;
+	/* xorshift64* must not start from 0 */
+	random_state = (seed != 0) ? seed : 0x9E3779B97F4A7C15ULL;
+	return 0;
+}
+
+/*
+ * Function:  random_below
+ * --------------------
+ * Draw a number from the random number generator of the calling thread
+ * (xorshift64*)
+ *
+ *  n: Number of possible results
+ *
+ *  returns: A number from 0 to n - 1
+ */
+int random_below(int n){
+	random_state ^= random_state >> 12;
+	random_state ^= random_state << 25;
+	random_state ^= random_state >> 27;
+	return (int) (((random_state * 0x2545F4914F6CDD1DULL) >> 32) % (uint64_t) n);
+}
+
+/*
+ * Function:  parse_engine
+ * --------------------
+ * Read an engine of the self-play games: random, ab, pvs or search,
+ * optionally followed by :depth (SEARCH_DEPTH by default, 2 for search)
+ *
+ *  name: The name
+ *  engine: The engine (output)
+ *
+ *  returns: 1 if the name is known and 0 otherwise
+ */
+int parse_engine(const char *name, Engine *engine){
+	static const char *names[4] = {"random", "ab", "pvs", "search"};
+	const char *colon = strchr(name, ':');
+	size_t length = (colon != NULL) ? (size_t) (colon - name) : strlen(name);
+	int kind;
+	for (kind = 0; kind < 4; kind++){
+		if ((strlen(names[kind]) == length) && (strncmp(name, names[kind], length) == 0)){
+			break;
+		}
+	}
+	if (kind == 4){
+		return 0;
+	}
+	engine->kind = kind;
+	engine->depth = (kind == SEARCH_ENGINE) ? 2 : SEARCH_DEPTH;
+	if (colon != NULL){
+		engine->depth = atoi(colon + 1);
+	}
+	return engine->depth > 0;
+}
+
+/*
+ * Function:  engine_choose
+ * --------------------
+ * Choose the move of an engine. The moves are shuffled first and the first
+ * best one is kept, so that equally good moves are played at random
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *  engine: The engine
+ *
+ *  returns: The move
+ */
+int engine_choose(Bitboard *board, int is_maximizer, const Engine *engine){
+	int move_list[NUM_OF_CELLS];
+	int num_of_moves, move_id, other, temp;
+	int value, best_value = ARBITRARILY_LOW_VALUE;
+	int best_move;
+	int killer_move = NO_MOVE;
+
+	num_of_moves = generate_moves(board, is_maximizer, move_list);
+	for (move_id = num_of_moves - 1; move_id > 0; move_id--){
+		other = random_below(move_id + 1);
+		temp = move_list[move_id];
+		move_list[move_id] = move_list[other];
+		move_list[other] = temp;
+	}
+	best_move = move_list[0];
+	if ((engine->kind == RANDOM_ENGINE) || (num_of_moves == 1)){
+		return best_move;
+	}
+	/* Values from the point of view of the player to move, each move
+	   searched with the best value so far as the lower bound */
+	for (move_id = 0; move_id < num_of_moves; move_id++){
+		make_move(board, move_list[move_id], is_maximizer);
+		if (engine->kind == ALPHA_BETA_ENGINE){
+			if (is_maximizer){
+				value = alpha_beta_routine(board, 1, engine->depth, best_value, ARBITRARILY_HIGH_VALUE, 0,
+					&killer_move);
+			} else {
+				value = -alpha_beta_routine(board, 1, engine->depth, ARBITRARILY_LOW_VALUE, -best_value, 1,
+					&killer_move);
+			}
+		} else if (engine->kind == PRINCIPAL_VARIATION_ENGINE){
+			value = -principal_variation_search(board, 1, engine->depth, ARBITRARILY_LOW_VALUE, -best_value,
+				1 - is_maximizer, &killer_move);
+		} else {
+			value = (engine->depth == 1) ? evaluation_function(board)
+				: search(board, 1 - is_maximizer, 2, engine->depth);
+			if (is_maximizer == 0){
+				value = -value;
+			}
+		}
+		unmake_move(board, move_list[move_id], is_maximizer);
+		if (value > best_value){
+			best_value = value;
+			best_move = move_list[move_id];
+		}
+	}
+	return best_move;
+}
+
+/*
+ * Function:  play_game
+ * --------------------
+ * Play a game from the empty board between two engines, 'x' first
+ *
+ *  engines: Engine of 'o' and of 'x'
+ *  num_of_plies: Number of moves played (output)
+ *
+ *  returns: The final Bitboard.status
+ */
+int play_game(const Engine engines[2], int *num_of_plies){
+	Bitboard board;
+	int is_maximizer = 1;
+	clear_board(&board);
+	while (board.status == ONGOING){
+		make_move(&board, engine_choose(&board, is_maximizer, &engines[is_maximizer]), is_maximizer);
+		is_maximizer = 1 - is_maximizer;
+	}
+	*num_of_plies = board.num_of_moves;
+	return board.status;
+}
+
+/*
+ * Function:  self_play_worker
+ * --------------------
+ * Body of a self-play thread: play its games and count the results
+ *
+ *  arg: Pointer to the SelfPlay of the thread
+ *
+ *  returns: NULL
+ */
+void *self_play_worker(void *arg){
+	SelfPlay *games = arg;
+	long game;
+	int num_of_plies;
+	seed_random(games->seed);
+	num_of_nodes = 0;
+	for (game = 0; game < games->num_of_games; game++){
+		games->num_of_results[play_game(games->engines, &num_of_plies)]++;
+		games->num_of_plies += num_of_plies;
+	}
+	games->num_of_nodes = num_of_nodes;
+	return NULL;
+}
+
+/*
+ * Function:  run_self_play
+ * --------------------
+ * Play games between two engines, split evenly over threads which share
+ * nothing but the transposition table
+ *
+ *  num_of_games: Number of games
+ *  threads: Number of threads
+ *  engines: Engine of 'o' and of 'x'
+ *  seed: Seed of the random number generators, thread i using seed + i
+ *  total: The results of all the games (output)
+ *
+ *  returns: The wall-clock time in seconds
+ */
+double run_self_play(long num_of_games, int threads, const Engine engines[2], uint64_t seed, SelfPlay *total){
+	pthread_t workers[MAX_THREADS];
+	SelfPlay games[MAX_THREADS];
+	double tic = wall_clock();
+	int i, result;
+
+	memset(games, 0, sizeof(games));
+	for (i = 0; i < threads; i++){
+		games[i].engines = engines;
+		games[i].num_of_games = num_of_games / threads + (i < num_of_games % threads);
+		games[i].seed = seed + i;
+	}
+	for (i = 1; i < threads; i++){
+		pthread_create(&workers[i], NULL, self_play_worker, &games[i]);
+	}
+	self_play_worker(&games[0]);
+	for (i = 1; i < threads; i++){
+		pthread_join(workers[i], NULL);
+	}
+
+	memset(total, 0, sizeof(*total));
+	total->engines = engines;
+	total->seed = seed;
+	for (i = 0; i < threads; i++){
+		total->num_of_games += games[i].num_of_games;
+		for (result = 0; result < 4; result++){
+			total->num_of_results[result] += games[i].num_of_results[result];
+		}
+		total->num_of_plies += games[i].num_of_plies;
+		total->num_of_nodes += games[i].num_of_nodes;
+	}
+	return wall_clock() - tic;
+}
+
+/*
+ * Function:  self_play
+ * --------------------
+ * Run ./tic-tac-toe selfplay games threads x-engine o-engine seed (all
+ * optional: 10000 games on 1 thread, ab against ab, seeded by the time)
+ * and print the results
+ *
+ *  argc, argv: The arguments of the program
+ *
+ *  returns: 0, or 1 for a bad argument
+ */
+int self_play(int argc, char *argv[]){
+	Engine engines[2];
+	SelfPlay total;
+	long num_of_games = (argc > 2) ? atol(argv[2]) : 10000;
+	int threads = (argc > 3) ? atoi(argv[3]) : 1;
+	uint64_t seed = (argc > 6) ? strtoull(argv[6], NULL, 10) : (uint64_t) time(NULL);
+	double seconds;
+
+	if ((num_of_games < 1) || (threads < 1) || (threads > MAX_THREADS)
+		|| (parse_engine((argc > 4) ? argv[4] : "ab", &engines[1]) == 0)
+		|| (parse_engine((argc > 5) ? argv[5] : "ab", &engines[0]) == 0)){
+		printf("Usage: %s selfplay games threads x-engine o-engine seed\n", argv[0]);
+		printf("where an engine is random, ab, pvs or search, optionally followed by :depth\n");
+		return 1;
+	}
+	seconds = run_self_play(num_of_games, threads, engines, seed, &total);
+	printf("%-8s %8s %10s %12s %10s %10s %10s %10s %12s\n", "games", "threads", "seconds", "games/sec",
+		"x wins", "o wins", "draws", "plies", "nodes/sec");
+	printf("%-8ld %8d %10.3f %12.0f %10ld %10ld %10ld %10.2f %12.0f\n", total.num_of_games, threads, seconds,
+		total.num_of_games / (seconds > 0 ? seconds : 1e-9), total.num_of_results[X_WINS],
+		total.num_of_results[O_WINS], total.num_of_results[DRAW], (double) total.num_of_plies / total.num_of_games,
+		total.num_of_nodes / (seconds > 0 ? seconds : 1e-9));
+	return 0;
+}
+
+/*
+ * Function:  run_benchmark
+ * --------------------
+ * Run min_max, alpha_beta_routine and search from the empty board, once on
+ * the char board[3][3] and once on the bitboard, and print the nodes per
+ * second (3x3 only, without the transposition table). Then run
+ * run_search_benchmark, run_iterative_deepening_benchmark,
+ * run_table_tearing_test, run_parallel_benchmark and run_self_play_benchmark
+ *
+ *  returns: 0 if every comparison agrees and 1 otherwise
+ */
+int run_benchmark(void){
+	int mismatch = 0;
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+	static const char *names[3] = {"min_max", "alpha_beta_routine", "search"};
+	static const int num_of_runs[3] = {20, 2000, 2000};
+	char char_board[3][3];
+	Bitboard board;
+	int routine, run, representation;
+	int killer_move;
+	int values[2] = {0, 0};
+	long nodes[2];
+	double seconds[2];
+	clock_t tic;
+
+	/* The char board routines have no transposition table and no history heuristic */
+	use_transposition_table = 0;
+	use_history_heuristic = 0;
+	printf("%-20s %-10s %12s %10s %14s\n", "routine", "board", "nodes", "seconds", "nodes/sec");
+	for (routine = 0; routine < 3; routine++){
+		for (representation = 0; representation < 2; representation++){
+			memset(char_board, '_', sizeof(char_board));
+			clear_board(&board);
+			num_of_nodes = 0;
+			tic = clock();
+			for (run = 0; run < num_of_runs[routine]; run++){
+				killer_move = NO_MOVE;
+				if (representation == 0){
+					switch (routine){
+						case 0: values[0] = char_board_min_max(char_board, 1); break;
+						case 1: values[0] = char_board_alpha_beta_routine(char_board, 0,
+							ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 1, &killer_move); break;
+						default: values[0] = char_board_search(char_board, 1, 0, 3); break;
+					}
+				} else {
+					switch (routine){
+						case 0: values[1] = min_max(&board, 1); break;
+						case 1: values[1] = alpha_beta_routine(&board, 0, NUM_OF_CELLS,
+							ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 1, &killer_move); break;
+						default: values[1] = search(&board, 1, 0, 3); break;
+					}
+				}
+			}
+			seconds[representation] = (double)(clock() - tic) / CLOCKS_PER_SEC;
+			nodes[representation] = num_of_nodes;
+			printf("%-20s %-10s %12ld %10.3f %14.0f\n", names[routine],
+				(representation == 0) ? "char[3][3]" : "bitboard",
+				nodes[representation], seconds[representation],
+				nodes[representation] / (seconds[representation] > 0 ? seconds[representation] : 1e-9));
+		}
+		if ((values[0] != values[1]) || (nodes[0] != nodes[1])){
+			printf("MISMATCH in %s: value %d vs %d, nodes %ld vs %ld\n", names[routine],
+				values[0], values[1], nodes[0], nodes[1]);
+			mismatch = 1;
+		}
+		printf("%-20s speedup %.2fx\n\n", names[routine],
+			(seconds[0] / nodes[0]) / ((seconds[1] > 0 ? seconds[1] : 1e-9) / nodes[1]));
+	}
+	use_transposition_table = 1;
+	use_history_heuristic = 1;
+#endif
+	mismatch |= run_search_benchmark();
+	run_iterative_deepening_benchmark();
+	mismatch |= run_table_tearing_test();
+	mismatch |= run_parallel_benchmark();
+	mismatch |= run_self_play_benchmark();
+	mismatch |= run_perft_benchmark(PERFT_DEPTH, 8);
+#if NUM_OF_CELLS <= 64
+	mismatch |= run_game_pool_benchmark();
+#endif
+	return mismatch;
+}
+
+/*
+ * Function:  run_search_benchmark
+ * --------------------
+ * Search the empty board to SEARCH_DEPTH with alpha_beta_routine without
+ * the transposition table, with it indexed by key[0] and with it indexed
+ * by the canonical key, then the same with principal_variation_search, and
+ * print the nodes and the table entries used
+ *
+ *  returns: 0 if all the searches find the same value and 1 otherwise
+ */
+int run_search_benchmark(void){
+	static const char *names[3] = {"none", "key[0]", "canonical key"};
+	Bitboard board;
+	int killer_move;
+	int routine, mode;
+	int values[2][3];
+	long nodes[2][3];
+	double seconds;
+	clock_t tic;
+	int mismatch = 0;
+
+	printf("Empty %dx%d board, %d in a row, to depth %d\n", BOARD_M, BOARD_N, BOARD_K, SEARCH_DEPTH);
+	printf("%-28s %-14s %12s %10s %10s %14s\n", "routine", "table", "nodes", "seconds", "value", "entries used");
+	for (routine = 0; routine < 2; routine++){
+		for (mode = 0; mode < 3; mode++){
+			use_transposition_table = (mode > 0);
+			use_canonical_keys = (mode == 2);
+			clear_transposition_table();
+			clear_history_tables();
+			clear_board(&board);
+			killer_move = NO_MOVE;
+			num_of_nodes = 0;
+			tic = clock();
+			if (routine == ALPHA_BETA_ROUTINE){
+				values[routine][mode] = alpha_beta_routine(&board, 0, SEARCH_DEPTH,
+					ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 1, &killer_move);
+			} else {
+				values[routine][mode] = principal_variation_search(&board, 0, SEARCH_DEPTH,
+					ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE, 1, &killer_move);
+			}
+			seconds = (double)(clock() - tic) / CLOCKS_PER_SEC;
+			nodes[routine][mode] = num_of_nodes;
+			printf("%-28s %-14s %12ld %10.3f %10d %14d\n",
+				(routine == ALPHA_BETA_ROUTINE) ? "alpha_beta_routine" : "principal_variation_search",
+				names[mode], nodes[routine][mode], seconds, values[routine][mode], num_of_used_entries());
+			if (values[routine][mode] != values[0][0]){
+				printf("MISMATCH: value %d, %d without the transposition table in alpha_beta_routine\n",
+					values[routine][mode], values[0][0]);
+				mismatch = 1;
+			}
+		}
+	}
+	use_transposition_table = 1;
+	use_canonical_keys = 1;
+	printf("alpha_beta_routine: %.1fx fewer nodes with the transposition table, %.1fx with canonical keys\n",
+		(double) nodes[0][0] / nodes[0][1], (double) nodes[0][0] / nodes[0][2]);
+	printf("principal_variation_search: %.2fx the nodes of alpha_beta_routine without the table, "
+		"%.2fx with canonical keys\n",
+		(double) nodes[1][0] / nodes[0][0], (double) nodes[1][2] / nodes[0][2]);
+	return mismatch;
+}
+
+/*
+ * Function:  run_iterative_deepening_benchmark
+ * --------------------
+ * Let computer_choose search the empty board and the board after the first
+ * two moves of ordered_moves, without time limit, with each routine, with
+ * and without aspiration windows, with and without the history heuristic
+ * (starting from an empty transposition table, empty history tables and a
+ * first guess of 0), and print the nodes, the value, the number of MTD(f)
+ * passes and of aspiration re-searches
+ *
+ *  returns: 0
+ */
+int run_iterative_deepening_benchmark(void){
+	static const char *names[3] = {"alpha_beta_routine", "principal_variation_search", "mtdf"};
+	static const int routines[5] = {ALPHA_BETA_ROUTINE, ALPHA_BETA_ROUTINE, PRINCIPAL_VARIATION_SEARCH,
+		PRINCIPAL_VARIATION_SEARCH, MTDF};
+	static const int windows[5] = {0, ASPIRATION_WINDOW, 0, ASPIRATION_WINDOW, 0};
+	Bitboard board;
+	int position, run, history, depth;
+	int row_choice, col_choice;
+	double seconds;
+	clock_t tic;
+
+	printf("\nIterative deepening up to depth %d\n", SEARCH_DEPTH);
+	printf("%-10s %-28s %8s %8s %12s %10s %10s %6s %8s %12s\n", "position", "routine", "window", "history",
+		"nodes", "seconds", "value", "depth", "passes", "re-searches");
+	time_budget = 0;
+	for (position = 0; position < 2; position++){
+		for (run = 0; run < 10; run++){
+			search_routine = routines[run / 2];
+			aspiration_window = windows[run / 2];
+			history = run % 2;
+			use_history_heuristic = history;
+			clear_transposition_table();
+			clear_history_tables();
+			clear_board(&board);
+			if (position == 1){
+				make_move(&board, ordered_moves[0], 1);
+				make_move(&board, ordered_moves[1], 0);
+			}
+			previous_value = 0;
+			num_of_nodes = 0;
+			num_of_passes = 0;
+			num_of_researches = 0;
+			tic = clock();
+			depth = computer_choose(&board, &row_choice, &col_choice);
+			seconds = (double)(clock() - tic) / CLOCKS_PER_SEC;
+			printf("%-10s %-28s %8d %8s %12ld %10.3f %10d %6d %8ld %12ld\n",
+				(position == 0) ? "empty" : "2 moves", names[search_routine], aspiration_window,
+				history ? "on" : "off", num_of_nodes, seconds, previous_value, depth, num_of_passes,
+				num_of_researches);
+		}
+	}
+	time_budget = TIME_BUDGET;
+	search_routine = ALPHA_BETA_ROUTINE;
+	aspiration_window = ASPIRATION_WINDOW;
+	use_history_heuristic = 1;
+	previous_value = 0;
+	return 0;
+}
+
+/*
+ * Function:  tearing_fields
+ * --------------------
+ * Fields written with a key by run_table_tearing_test: the best move and
+ * the draft are taken from the key, so an entry whose data comes from
+ * another key can be told
+ *
+ *  key: The key
+ *  value: The value to write
+ *
+ *  returns: The packed fields
+ */
+uint64_t tearing_fields(uint64_t key, int value){
+	return PACK_ENTRY(value, (int) ((key >> 40) & 0x3fff), (int) ((key >> 56) & 63), EXACT_BOUND);
+}
+
+/*
+ * Function:  tearing_writer
+ * --------------------
+ * Thread of run_table_tearing_test writing the keys of tearing_keys in turn
+ * to the entry TEARING_INDEX, each time with another value
+ *
+ *  arg: Pointer to the index of the thread
+ *
+ *  returns: NULL
+ */
+void *tearing_writer(void *arg){
+	int i, id = *(const int *) arg;
+	uint64_t key;
+	for (i = 0; i < TEARING_WRITES; i++){
+		key = tearing_keys[(i + id) % NUM_OF_TEARING_KEYS];
+		write_table_entry(TEARING_INDEX, key, tearing_fields(key, i));
+	}
+	return NULL;
+}
+
+/*
+ * Function:  tearing_reader
+ * --------------------
+ * Thread of run_table_tearing_test reading the entry TEARING_INDEX until
+ * the writers are done: count the reads whose two words come from
+ * different writes, and check every entry accepted by read_table_entry
+ *
+ *  arg: Unused
+ *
+ *  returns: NULL
+ */
+void *tearing_reader(void *arg){
+	uint64_t check, data;
+	int i, is_known;
+	long num_of_reads = 0;
+	(void) arg;
+	while (atomic_load(&tearing_writers_done) == 0){
+		check = atomic_load_explicit(&transposition_table[TEARING_INDEX].check, memory_order_relaxed);
+		/* Let the writers run between the two words now and then, as they would on another core */
+		if ((++num_of_reads & 15) == 0){
+			sched_yield();
+		}
+		data = atomic_load_explicit(&transposition_table[TEARING_INDEX].data, memory_order_relaxed);
+		is_known = (data == 0);
+		for (i = 0; i < NUM_OF_TEARING_KEYS; i++){
+			is_known |= ((check ^ data) == tearing_keys[i]);
+		}
+		if (is_known == 0){
+			atomic_fetch_add(&tearing_torn_reads, 1);
+		}
+		for (i = 0; i < NUM_OF_TEARING_KEYS; i++){
+			if (read_table_entry(TEARING_INDEX, tearing_keys[i], &data)){
+				atomic_fetch_add(&tearing_accepted_reads, 1);
+				if (data != tearing_fields(tearing_keys[i], ENTRY_VALUE(data))){
+					atomic_fetch_add(&tearing_wrong_reads, 1);
+				}
+			}
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Function:  run_table_tearing_test
+ * --------------------
+ * Have TEARING_THREADS threads write different keys to one entry of the
+ * transposition table while as many others read it, and print how many
+ * reads were torn (the two words from different writes, which
+ * read_table_entry must ignore) and how many entries read_table_entry
+ * accepted with the fields of another key, which must be none
+ *
+ *  returns: 0 if no such entry was accepted and 1 otherwise
+ */
+int run_table_tearing_test(void){
+	pthread_t writers[TEARING_THREADS], readers[TEARING_THREADS];
+	int ids[TEARING_THREADS];
+	int i;
+
+	for (i = 0; i < NUM_OF_TEARING_KEYS; i++){
+		tearing_keys[i] = (zobrist_keys[1][i] & ~(uint64_t) (TT_SIZE - 1)) | TEARING_INDEX;
+	}
+	atomic_store(&tearing_writers_done, 0);
+	atomic_store(&tearing_torn_reads, 0);
+	atomic_store(&tearing_accepted_reads, 0);
+	atomic_store(&tearing_wrong_reads, 0);
+	clear_transposition_table();
+	for (i = 0; i < TEARING_THREADS; i++){
+		ids[i] = i;
+		pthread_create(&readers[i], NULL, tearing_reader, NULL);
+		pthread_create(&writers[i], NULL, tearing_writer, &ids[i]);
+	}
+	for (i = 0; i < TEARING_THREADS; i++){
+		pthread_join(writers[i], NULL);
+	}
+	atomic_store(&tearing_writers_done, 1);
+	for (i = 0; i < TEARING_THREADS; i++){
+		pthread_join(readers[i], NULL);
+	}
+	clear_transposition_table();
+
+	printf("\nTransposition table tearing test, %d writers and %d readers of one entry\n", TEARING_THREADS,
+		TEARING_THREADS);
+	printf("%-10s %12s %12s %12s\n", "writes", "torn reads", "accepted", "wrong");
+	printf("%-10d %12ld %12ld %12ld\n", TEARING_THREADS * TEARING_WRITES, atomic_load(&tearing_torn_reads),
+		atomic_load(&tearing_accepted_reads), atomic_load(&tearing_wrong_reads));
+	if (atomic_load(&tearing_wrong_reads) > 0){
+		printf("MISMATCH: entries were accepted with the fields of another key\n");
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * Function:  run_parallel_benchmark
+ * --------------------
+ * Search the positions of run_iterative_deepening_benchmark to SEARCH_DEPTH
+ * with search_root, serially and in parallel on 2, 4, 8 and 16 threads:
+ * with ROOT_PARALLEL_SEARCH for each routine and with
+ * YOUNG_BROTHERS_WAIT_SEARCH and LAZY_SMP_SEARCH for alpha_beta_routine
+ * (whose workers only help through the table). Print the nodes, the
+ * wall-clock time, the speedup over the serial search and the search
+ * overhead (the nodes over those of the serial search). Without the
+ * transposition table the parallel searches must find the same best move
+ * and value as the serial one; with it they may not, as the threads fill
+ * it in another order
+ *
+ *  returns: 0 if every search without the table agrees and 1 otherwise
+ */
+int run_parallel_benchmark(void){
+	static const char *names[5] = {"root alpha_beta_routine", "root principal_variation", "ybw alpha_beta_routine",
+		"ybw principal_variation", "lazy alpha_beta_routine"};
+	static const int routines[5] = {ALPHA_BETA_ROUTINE, PRINCIPAL_VARIATION_SEARCH, ALPHA_BETA_ROUTINE,
+		PRINCIPAL_VARIATION_SEARCH, ALPHA_BETA_ROUTINE};
+	static const int modes[5] = {ROOT_PARALLEL_SEARCH, ROOT_PARALLEL_SEARCH, YOUNG_BROTHERS_WAIT_SEARCH,
+		YOUNG_BROTHERS_WAIT_SEARCH, LAZY_SMP_SEARCH};
+	static const int thread_counts[5] = {1, 2, 4, 8, 16};
+	Bitboard board;
+	int move_list[NUM_OF_CELLS];
+	int num_of_moves;
+	int position, routine, table, run;
+	int value, best_move;
+	int serial_value = 0, serial_move = NO_MOVE;
+	long serial_nodes = 1;
+	double tic, seconds, serial_seconds = 0;
+	int mismatch = 0;
+
+	printf("\nParallel search to depth %d\n", SEARCH_DEPTH);
+	printf("%-10s %-26s %-6s %8s %12s %10s %8s %9s %10s %6s\n", "position", "mode", "table", "threads", "nodes",
+		"seconds", "speedup", "overhead", "value", "move");
+	time_budget = 0;
+	search_deadline = 0;
+	for (position = 0; position < 2; position++){
+		for (routine = 0; routine < 5; routine++){
+			for (table = 0; table < 2; table++){
+				for (run = 0; run < 5; run++){
+					search_routine = routines[routine];
+					use_transposition_table = table;
+					num_of_threads = thread_counts[run];
+					parallel_mode = (num_of_threads > 1) ? modes[routine] : SERIAL_SEARCH;
+					clear_transposition_table();
+					clear_history_tables();
+					clear_board(&board);
+					if (position == 1){
+						make_move(&board, ordered_moves[0], 1);
+						make_move(&board, ordered_moves[1], 0);
+					}
+					num_of_moves = generate_moves(&board, 1, move_list);
+					best_move = NO_MOVE;
+					num_of_nodes = 0;
+					tic = wall_clock();
+					start_helpers(&board);
+					value = search_root(&board, move_list, num_of_moves, SEARCH_DEPTH, ARBITRARILY_LOW_VALUE,
+						ARBITRARILY_HIGH_VALUE, &best_move);
+					stop_helpers();
+					seconds = wall_clock() - tic;
+					if (run == 0){
+						serial_value = value;
+						serial_move = best_move;
+						serial_seconds = seconds;
+						serial_nodes = (num_of_nodes > 0) ? num_of_nodes : 1;
+					}
+					printf("%-10s %-26s %-6s %8d %12ld %10.3f %7.2fx %8.2fx %10d %3d %-3d\n",
+						(position == 0) ? "empty" : "2 moves", names[routine], table ? "on" : "off",
+						num_of_threads, num_of_nodes, seconds, serial_seconds / (seconds > 0 ? seconds : 1e-9),
+						(double) num_of_nodes / serial_nodes, value, best_move / BOARD_N + 1,
+						best_move % BOARD_N + 1);
+					if ((table == 0) && ((value != serial_value) || (best_move != serial_move))){
+						printf("MISMATCH: the serial search found value %d, move %d\n", serial_value, serial_move);
+						mismatch = 1;
+					}
+				}
+			}
+		}
+	}
+
+	/* A window no move can reach: the root fails low and must still give a move of the list */
+	search_routine = ALPHA_BETA_ROUTINE;
+	use_transposition_table = 0;
+	num_of_threads = 2;
+	parallel_mode = ROOT_PARALLEL_SEARCH;
+	clear_board(&board);
+	num_of_moves = generate_moves(&board, 1, move_list);
+	best_move = NO_MOVE;
+	value = search_root(&board, move_list, num_of_moves, 2, ARBITRARILY_HIGH_VALUE - 1, ARBITRARILY_HIGH_VALUE,
+		&best_move);
+	printf("%-10s %-26s %-6s %8d %12s %10s %8s %9s %10d %3d %-3d\n", "fail-low", names[0], "off", num_of_threads,
+		"-", "-", "-", "-", value, best_move / BOARD_N + 1, best_move % BOARD_N + 1);
+	if ((value >= ARBITRARILY_HIGH_VALUE - 1) || (best_move != move_list[0])){
+		printf("MISMATCH: a root search failing low must keep the first move, %d\n", move_list[0]);
+		mismatch = 1;
+	}
+
+	time_budget = TIME_BUDGET;
+	search_routine = ALPHA_BETA_ROUTINE;
+	use_transposition_table = 1;
+	num_of_threads = 1;
+	parallel_mode = SERIAL_SEARCH;
+	return mismatch;
+}
+
+/*
+ * Function:  run_self_play_benchmark
+ * --------------------
+ * Play SELF_PLAY_BENCH_GAMES games of alpha_beta_routine to
+ * SELF_PLAY_BENCH_DEPTH plies against itself and against random moves, on
+ * 1, 2, 4 and 8 threads, and print the games per second and the speedup
+ * over 1 thread. On boards of at most 9 cells the search sees the whole
+ * game, so it must never lose, and two of them must always draw on 3x3
+ *
+ *  returns: 0 if no game contradicts this and 1 otherwise
+ */
+int run_self_play_benchmark(void){
+	static const char *names[2] = {"ab against ab", "ab against random"};
+	static const int thread_counts[4] = {1, 2, 4, 8};
+	Engine engines[2];
+	SelfPlay total;
+	int pairing, run;
+	double seconds, serial_seconds = 0;
+	int mismatch = 0;
+
+	printf("\nSelf-play, %d games, alpha_beta_routine to %d plies\n", SELF_PLAY_BENCH_GAMES, SELF_PLAY_BENCH_DEPTH);
+	printf("%-18s %8s %10s %12s %8s %10s %10s %10s %10s\n", "engines", "threads", "seconds", "games/sec",
+		"speedup", "x wins", "o wins", "draws", "plies");
+	engines[1].kind = ALPHA_BETA_ENGINE;
+	engines[1].depth = SELF_PLAY_BENCH_DEPTH;
+	for (pairing = 0; pairing < 2; pairing++){
+		engines[0].kind = (pairing == 0) ? ALPHA_BETA_ENGINE : RANDOM_ENGINE;
+		engines[0].depth = SELF_PLAY_BENCH_DEPTH;
+		for (run = 0; run < 4; run++){
+			clear_transposition_table();
+			seconds = run_self_play(SELF_PLAY_BENCH_GAMES, thread_counts[run], engines, 1, &total);
+			if (run == 0){
+				serial_seconds = seconds;
+			}
+			printf("%-18s %8d %10.3f %12.0f %7.2fx %10ld %10ld %10ld %10.2f\n", names[pairing], thread_counts[run],
+				seconds, SELF_PLAY_BENCH_GAMES / (seconds > 0 ? seconds : 1e-9),
+				serial_seconds / (seconds > 0 ? seconds : 1e-9), total.num_of_results[X_WINS],
+				total.num_of_results[O_WINS], total.num_of_results[DRAW],
+				(double) total.num_of_plies / total.num_of_games);
+#if NUM_OF_CELLS <= 9
+			if ((total.num_of_results[O_WINS] > 0)
+				|| ((pairing == 0) && (BOARD_K == 3) && (total.num_of_results[DRAW] != SELF_PLAY_BENCH_GAMES))){
+				printf("MISMATCH: a search of the whole game lost, or two of them did not draw\n");
+				mismatch = 1;
+			}
+#endif
+		}
+	}
+	return mismatch;
+}
+
+/*
+ * Function:  perft_worker
+ * --------------------
+ * Body of a perft thread: take the next first move of the Perft until
+ * there are none left, and count the leaves below it on a copy of the board
+ *
+ *  arg: The Perft
+ *
+ *  returns: NULL
+ */
+void *perft_worker(void *arg){
+	Perft *run = arg;
+	Bitboard board = *run->board;
+	int cell;
+	long num_of_leaves = 0;
+	while ((cell = atomic_fetch_add(&run->next_cell, 1)) < NUM_OF_CELLS){
+		if (is_empty(&board, cell) == 0){
+			continue;
+		}
+		make_move(&board, cell, 1);
+		num_of_leaves += perft(&board, run->depth - 1, 0);
+		unmake_move(&board, cell, 1);
+	}
+	atomic_fetch_add(&run->num_of_leaves, num_of_leaves);
+	return NULL;
+}
+
+/*
+ * Function:  run_perft
+ * --------------------
+ * Count the leaves of the game tree from the empty board, with the first
+ * moves shared among the threads
+ *
+ *  depth: Number of moves
+ *  threads: Number of threads, the calling thread included
+ *  num_of_leaves: Set to the number of leaves
+ *
+ *  returns: The wall-clock time taken, in seconds
+ */
+double run_perft(int depth, int threads, long *num_of_leaves){
+	pthread_t workers[MAX_THREADS];
+	Bitboard board;
+	Perft run;
+	double tic = wall_clock();
+	int i;
+
+	clear_board(&board);
+	if (depth == 0){
+		*num_of_leaves = 1;
+		return wall_clock() - tic;
+	}
+	run.board = &board;
+	run.depth = depth;
+	atomic_init(&run.next_cell, 0);
+	atomic_init(&run.num_of_leaves, 0);
+	for (i = 1; i < threads; i++){
+		pthread_create(&workers[i], NULL, perft_worker, &run);
+	}
+	perft_worker(&run);
+	for (i = 1; i < threads; i++){
+		pthread_join(workers[i], NULL);
+	}
+	*num_of_leaves = atomic_load(&run.num_of_leaves);
+	return wall_clock() - tic;
+}
+
+/*
+ * Function:  expected_perft
+ * --------------------
+ * Number of leaves of the game tree to a given depth, where it is known:
+ * before any line can be completed (2*BOARD_K - 1 moves) every sequence
+ * of moves is a leaf, and on the 3x3 board the counts follow from the
+ * number of games that end after 5 to 9 moves (1440, 5328, 47952, 72576
+ * and 127872, 255168 games in all)
+ *
+ *  depth: Number of moves
+ *
+ *  returns: The number of leaves, or -1 if it is not known
+ */
+long expected_perft(int depth){
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+	static const long leaves[10] = {1, 9, 72, 504, 3024, 15120, 56160, 154944, 255168, 255168};
+	return ((depth >= 0) && (depth <= 9)) ? leaves[depth] : -1;
+#else
+	long num_of_leaves = 1;
+	int i;
+	if ((depth > 2*BOARD_K - 1) || (depth > NUM_OF_CELLS)){
+		return -1;
+	}
+	for (i = 0; i < depth; i++){
+		num_of_leaves *= NUM_OF_CELLS - i;
+	}
+	return num_of_leaves;
+#endif
+}
+
+/*
+ * Function:  run_perft_benchmark
+ * --------------------
+ * Print the leaves of the game tree and the leaves per second for every
+ * depth up to max_depth on one thread, then for max_depth on 2, 4 ... up
+ * to threads threads, checking the counts against expected_perft (and, on
+ * the 3x3 board, against the char board[3][3] representation)
+ *
+ *  max_depth: The last depth counted
+ *  threads: The most threads used
+ *
+ *  returns: 0, or 1 if a count is wrong
+ */
+int run_perft_benchmark(int max_depth, int threads){
+	long num_of_leaves, expected;
+	double seconds;
+	int depth, run_threads;
+	int mismatch = 0;
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+	char char_board[3][3];
+	double tic;
+#endif
+
+	printf("\nperft on the %dx%d board (%d in a row)\n", BOARD_M, BOARD_N, BOARD_K);
+	printf("%-10s %6s %8s %14s %14s %10s %14s\n", "board", "depth", "threads", "leaves", "expected",
+		"seconds", "leaves/sec");
+	depth = 1;
+	run_threads = 1;
+	while (depth <= max_depth){
+		seconds = run_perft(depth, run_threads, &num_of_leaves);
+		expected = expected_perft(depth);
+		printf("%-10s %6d %8d %14ld ", "bitboard", depth, run_threads, num_of_leaves);
+		if (expected >= 0){
+			printf("%14ld ", expected);
+		} else {
+			printf("%14s ", "-");
+		}
+		printf("%10.3f %14.0f\n", seconds, num_of_leaves / (seconds > 0 ? seconds : 1e-9));
+		if ((expected >= 0) && (num_of_leaves != expected)){
+			printf("MISMATCH: %ld leaves at depth %d, expected %ld\n", num_of_leaves, depth, expected);
+			mismatch = 1;
+		}
+		/* The whole depth again on more threads */
+		if (depth < max_depth){
+			depth++;
+		} else if (run_threads < threads){
+			run_threads = (2*run_threads < threads) ? 2*run_threads : threads;
+		} else {
+			break;
+		}
+	}
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+	if (max_depth <= 9){
+		memset(char_board, '_', sizeof(char_board));
+		tic = wall_clock();
+		num_of_leaves = char_board_perft(char_board, max_depth, 1);
+		seconds = wall_clock() - tic;
+		printf("%-10s %6d %8d %14ld %14ld %10.3f %14.0f\n", "char[3][3]", max_depth, 1, num_of_leaves,
+			expected_perft(max_depth), seconds, num_of_leaves / (seconds > 0 ? seconds : 1e-9));
+		if (num_of_leaves != expected_perft(max_depth)){
+			printf("MISMATCH: %ld leaves on the char board, expected %ld\n", num_of_leaves,
+				expected_perft(max_depth));
+			mismatch = 1;
+		}
+	}
+#endif
+	return mismatch;
+}
+
+#if NUM_OF_CELLS <= 64
+/*
+ * Function:  init_game_pool
+ * --------------------
+ * Start the games of a GamePool from the empty board, each with its own
+ * random number generator: all of them, or the first num_of_games if
+ * there are fewer (the other slots stay idle)
+ *
+ *  pool: The GamePool
+ *  seed: Seed of the generators (game i is seeded from seed*POOL_SIZE + i)
+ *  num_of_games: Number of games to be played in the pool
+ *
+ *  returns: 0
+ */
+int init_game_pool(GamePool *pool, uint64_t seed, long num_of_games){
+	int i;
+	for (i = 0; i < POOL_SIZE; i++){
+		pool->x[i] = 0;
+		pool->o[i] = 0;
+		pool->num_of_moves[i] = 0;
+		pool->status[i] = ONGOING;
+		pool->active[i] = (i < num_of_games) ? ~(uint64_t) 0 : 0;
+		seed_random(seed*POOL_SIZE + i);
+		pool->random_state[i] = random_state;
+	}
+	pool->num_of_active = (num_of_games < POOL_SIZE) ? num_of_games : POOL_SIZE;
+	pool->num_of_starts_left = num_of_games - pool->num_of_active;
+	return 0;
+}
+
+/*
+ * Function:  generate_pool_moves
+ * --------------------
+ * Find the empty cells of every game of a GamePool
+ *
+ *  pool: The GamePool
+ *
+ *  returns: 0
+ */
+int generate_pool_moves(GamePool *pool){
+	int i;
+	for (i = 0; i < POOL_SIZE; i++){
+		pool->legal[i] = full_board & ~(pool->x[i] | pool->o[i]);
+	}
+	return 0;
+}
+
+/*
+ * Function:  count_bits
+ * --------------------
+ * Count the bits set in a word with shifts and masks only (no popcount
+ * instruction is assumed), so that the loops calling it can be vectorized
+ *
+ *  mask: The word
+ *
+ *  returns: The number of bits set
+ */
+uint64_t count_bits(uint64_t mask){
+	mask -= (mask >> 1) & 0x5555555555555555ULL;
+	mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);
+	mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (mask * 0x0101010101010101ULL) >> 56;
+}
+
+/*
+ * Function:  choose_pool_moves
+ * --------------------
+ * Choose a random empty cell in every game of a GamePool, with no branch:
+ * the n-th empty cell is found by halving the board, each time going to
+ * the upper half if the lower one has n empty cells or fewer
+ *
+ *  pool: The GamePool
+ *
+ *  returns: 0
+ */
+int choose_pool_moves(GamePool *pool){
+	int i, width;
+	uint64_t state, n, num_of_low, is_high, offset;
+	for (i = 0; i < POOL_SIZE; i++){
+		state = pool->random_state[i];
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		pool->random_state[i] = state;
+		n = (((state * 0x2545F4914F6CDD1DULL) >> 32) * count_bits(pool->legal[i])) >> 32;
+		offset = 0;
+		for (width = 32; width > 0; width /= 2){
+			num_of_low = count_bits((pool->legal[i] >> offset) & (((uint64_t) 1 << width) - 1));
+			is_high = (n >= num_of_low);
+			n -= is_high*num_of_low;
+			offset += is_high*width;
+		}
+		pool->move[i] = (uint64_t) 1 << offset;
+	}
+	return 0;
+}
+
+/*
+ * Function:  apply_pool_moves
+ * --------------------
+ * Make the chosen move in every game of a GamePool being played, for 'x'
+ * after an even number of moves and for 'o' after an odd one
+ *
+ *  pool: The GamePool
+ *
+ *  returns: 0
+ */
+int apply_pool_moves(GamePool *pool){
+	int i;
+	uint64_t is_x;
+	for (i = 0; i < POOL_SIZE; i++){
+		is_x = (pool->num_of_moves[i] & 1) - 1;
+		pool->x[i] |= pool->move[i] & is_x & pool->active[i];
+		pool->o[i] |= pool->move[i] & ~is_x & pool->active[i];
+		pool->num_of_moves[i] += pool->active[i] & 1;
+	}
+	return 0;
+}
+
+/*
+ * Function:  detect_pool_terminals
+ * --------------------
+ * Set the status of every game of a GamePool, looking for a line of
+ * BOARD_K of the player who has just moved (as in is_victorious, with the
+ * four directions combined instead of returning at the first line found).
+ * The games over for good stay ONGOING, so that they are not counted again
+ *
+ *  pool: The GamePool
+ *
+ *  returns: 0
+ */
+int detect_pool_terminals(GamePool *pool){
+	int i, direction, k;
+	uint64_t x_moved, mover, run, lines;
+	for (i = 0; i < POOL_SIZE; i++){
+		x_moved = (uint64_t) 0 - (pool->num_of_moves[i] & 1);
+		mover = (pool->x[i] & x_moved) | (pool->o[i] & ~x_moved);
+		lines = 0;
+		for (direction = 0; direction < 4; direction++){
+			run = mover & line_starts[direction];
+			for (k = 1; k < BOARD_K; k++){
+				run &= mover >> (k*direction_shift[direction]);
+			}
+			lines |= run;
+		}
+		if (lines != 0){
+			pool->status[i] = (x_moved != 0) ? X_WINS : O_WINS;
+		} else {
+			pool->status[i] = (pool->num_of_moves[i] == NUM_OF_CELLS) ? DRAW : ONGOING;
+		}
+		pool->status[i] &= pool->active[i];
+	}
+	return 0;
+}
+
+/*
+ * Function:  recycle_pool_games
+ * --------------------
+ * Count the games of a GamePool that have ended and start new ones in
+ * their slots, in place, as long as pool->num_of_starts_left allows: the
+ * slots of the others stay idle until every game of the pool is over
+ *
+ *  pool: The GamePool
+ *  games: Where the results and plies are added
+ *
+ *  returns: The number of games that have ended
+ */
+long recycle_pool_games(GamePool *pool, SelfPlay *games){
+	int i;
+	long x_wins = 0, o_wins = 0, draws = 0, num_of_plies = 0, num_of_ended;
+	uint64_t keep;
+	for (i = 0; i < POOL_SIZE; i++){
+		x_wins += (pool->status[i] == X_WINS);
+		o_wins += (pool->status[i] == O_WINS);
+		draws += (pool->status[i] == DRAW);
+		num_of_plies += (long) (pool->num_of_moves[i] & ((uint64_t) 0 - (pool->status[i] != ONGOING)));
+	}
+	num_of_ended = x_wins + o_wins + draws;
+	if (pool->num_of_starts_left >= num_of_ended){
+		/* A new game in every slot whose game ended */
+		for (i = 0; i < POOL_SIZE; i++){
+			keep = (uint64_t) 0 - (pool->status[i] == ONGOING);
+			pool->x[i] &= keep;
+			pool->o[i] &= keep;
+			pool->num_of_moves[i] &= keep;
+			pool->status[i] = ONGOING;
+		}
+		pool->num_of_starts_left -= num_of_ended;
+	} else {
+		/* The last games to be started: the slots left over become idle */
+		for (i = 0; i < POOL_SIZE; i++){
+			if (pool->status[i] == ONGOING){
+				continue;
+			}
+			if (pool->num_of_starts_left > 0){
+				pool->x[i] = 0;
+				pool->o[i] = 0;
+				pool->num_of_moves[i] = 0;
+				pool->num_of_starts_left--;
+			} else {
+				pool->active[i] = 0;
+				pool->num_of_active--;
+			}
+			pool->status[i] = ONGOING;
+		}
+	}
+	games->num_of_results[X_WINS] += x_wins;
+	games->num_of_results[O_WINS] += o_wins;
+	games->num_of_results[DRAW] += draws;
+	games->num_of_plies += num_of_plies;
+	return num_of_ended;
+}
+
+/*
+ * Function:  check_pool_status
+ * --------------------
+ * Compare the status of every game of a GamePool being played with
+ * is_victorious
+ *
+ *  pool: The GamePool, after detect_pool_terminals
+ *
+ *  returns: The number of games whose status is wrong
+ */
+int check_pool_status(const GamePool *pool){
+	int i, status;
+	int num_of_errors = 0;
+	for (i = 0; i < POOL_SIZE; i++){
+		if (is_victorious(pool->x[i])){
+			status = X_WINS;
+		} else if (is_victorious(pool->o[i])){
+			status = O_WINS;
+		} else {
+			status = (pool->num_of_moves[i] == NUM_OF_CELLS) ? DRAW : ONGOING;
+		}
+		num_of_errors += (pool->active[i] != 0) && ((uint64_t) status != pool->status[i]);
+	}
+	return num_of_errors;
+}
+
+/*
+ * Function:  game_pool_worker
+ * --------------------
+ * Body of a game pool thread: advance a GamePool of random games one move
+ * at a time until games->num_of_games have been started and played to the
+ * end
+ *
+ *  arg: The SelfPlay of the thread, whose num_of_games is set to 0 if
+ *  there is not enough memory
+ *
+ *  returns: NULL
+ */
+void *game_pool_worker(void *arg){
+	SelfPlay *games = arg;
+	GamePool *pool = malloc(sizeof(GamePool));
+	long num_of_games = 0;
+	if (pool == NULL){
+		games->num_of_games = 0;
+		return NULL;
+	}
+	init_game_pool(pool, games->seed, games->num_of_games);
+	while (num_of_games < games->num_of_games){
+		games->num_of_idle_moves += POOL_SIZE - pool->num_of_active;
+		generate_pool_moves(pool);
+		choose_pool_moves(pool);
+		apply_pool_moves(pool);
+		detect_pool_terminals(pool);
+		num_of_games += recycle_pool_games(pool, games);
+	}
+	games->num_of_games = num_of_games;
+	free(pool);
+	return NULL;
+}
+
+/*
+ * Function:  run_game_pool
+ * --------------------
+ * Play random games in a GamePool on each thread, num_of_games in all
+ *
+ *  num_of_games: Number of games
+ *  threads: Number of threads, the calling thread included
+ *  seed: Seed of the random number generators
+ *  total: Set to the games of all the threads, and their results
+ *
+ *  returns: The wall-clock time taken, in seconds
+ */
+double run_game_pool(long num_of_games, int threads, uint64_t seed, SelfPlay *total){
+	pthread_t workers[MAX_THREADS];
+	SelfPlay games[MAX_THREADS];
+	double tic = wall_clock();
+	int i, result;
+
+	memset(games, 0, sizeof(games));
+	for (i = 0; i < threads; i++){
+		games[i].num_of_games = num_of_games / threads + (i < num_of_games % threads);
+		games[i].seed = seed + i;
+	}
+	for (i = 1; i < threads; i++){
+		pthread_create(&workers[i], NULL, game_pool_worker, &games[i]);
+	}
+	game_pool_worker(&games[0]);
+	for (i = 1; i < threads; i++){
+		pthread_join(workers[i], NULL);
+	}
+
+	memset(total, 0, sizeof(*total));
+	total->seed = seed;
+	for (i = 0; i < threads; i++){
+		total->num_of_games += games[i].num_of_games;
+		for (result = 0; result < 4; result++){
+			total->num_of_results[result] += games[i].num_of_results[result];
+		}
+		total->num_of_plies += games[i].num_of_plies;
+		total->num_of_idle_moves += games[i].num_of_idle_moves;
+	}
+	return wall_clock() - tic;
+}
+
+/*
+ * Function:  game_pool
+ * --------------------
+ * ./tic-tac-toe pool games threads seed: play random games in game pools
+ * and print the games per second and the results
+ *
+ *  argc, argv: The arguments of main
+ *
+ *  returns: 0, or 1 if the arguments are wrong
+ */
+int game_pool(int argc, char *argv[]){
+	SelfPlay total;
+	long num_of_games = (argc > 2) ? atol(argv[2]) : 1000000;
+	int threads = (argc > 3) ? atoi(argv[3]) : 1;
+	uint64_t seed = (argc > 4) ? strtoull(argv[4], NULL, 10) : (uint64_t) time(NULL);
+	double seconds;
+
+	if ((num_of_games < 1) || (threads < 1) || (threads > MAX_THREADS)){
+		printf("Usage: %s pool games threads seed\n", argv[0]);
+		return 1;
+	}
+	seconds = run_game_pool(num_of_games, threads, seed, &total);
+	if (total.num_of_games < num_of_games){
+		printf("Out of memory\n");
+		return 1;
+	}
+	printf("%-8s %8s %10s %12s %10s %10s %10s %10s\n", "games", "threads", "seconds", "games/sec",
+		"x wins", "o wins", "draws", "plies");
+	printf("%-8ld %8d %10.3f %12.0f %10ld %10ld %10ld %10.2f\n", total.num_of_games, threads, seconds,
+		total.num_of_games / (seconds > 0 ? seconds : 1e-9), total.num_of_results[X_WINS],
+		total.num_of_results[O_WINS], total.num_of_results[DRAW], (double) total.num_of_plies / total.num_of_games);
+	printf("Every game started was played to the end: %ld moves of pool slots (%.1f%%) were idle, waiting for\n"
+		"the last games of their pool\n", total.num_of_idle_moves,
+		100.0 * total.num_of_idle_moves / (total.num_of_idle_moves + total.num_of_plies));
+	return 0;
+}
+
+/*
+ * Function:  run_game_pool_benchmark
+ * --------------------
+ * Check the status found by detect_pool_terminals against is_victorious
+ * over POOL_CHECK_STEPS moves of a pool, then compare the games per second
+ * of random games played one by one (self-play, random against random)
+ * with those of game pools, on 1 to 8 threads
+ *
+ *  returns: 0, or 1 if a status is wrong or there is not enough memory
+ */
+int run_game_pool_benchmark(void){
+	static const int thread_counts[4] = {1, 2, 4, 8};
+	Engine engines[2];
+	SelfPlay total, games;
+	GamePool *pool = malloc(sizeof(GamePool));
+	int step, run, num_of_errors = 0;
+	double seconds, serial_seconds;
+
+	if (pool == NULL){
+		printf("Out of memory\n");
+		return 1;
+	}
+	memset(&games, 0, sizeof(games));
+	init_game_pool(pool, 1, (long) POOL_SIZE * POOL_CHECK_STEPS);
+	for (step = 0; step < POOL_CHECK_STEPS; step++){
+		generate_pool_moves(pool);
+		choose_pool_moves(pool);
+		apply_pool_moves(pool);
+		detect_pool_terminals(pool);
+		num_of_errors += check_pool_status(pool);
+		recycle_pool_games(pool, &games);
+	}
+	free(pool);
+	printf("\nGame pool of %d games: %d moves checked against is_victorious, %d errors\n", POOL_SIZE,
+		POOL_CHECK_STEPS, num_of_errors);
+
+	printf("%-12s %8s %10s %12s %8s %10s %10s %10s %10s\n", "games", "threads", "seconds", "games/sec",
+		"speedup", "x wins", "o wins", "draws", "plies");
+	engines[0].kind = RANDOM_ENGINE;
+	engines[0].depth = 0;
+	engines[1] = engines[0];
+	serial_seconds = run_self_play(POOL_BENCH_GAMES, 1, engines, 1, &total);
+	printf("%-12s %8d %10.3f %12.0f %7.2fx %10ld %10ld %10ld %10.2f\n", "one by one", 1, serial_seconds,
+		total.num_of_games / (serial_seconds > 0 ? serial_seconds : 1e-9), 1.0, total.num_of_results[X_WINS],
+		total.num_of_results[O_WINS], total.num_of_results[DRAW], (double) total.num_of_plies / total.num_of_games);
+	serial_seconds /= total.num_of_games;
+	for (run = 0; run < 4; run++){
+		seconds = run_game_pool(POOL_BENCH_GAMES, thread_counts[run], 1, &total);
+		if (total.num_of_games < POOL_BENCH_GAMES){
+			printf("Out of memory\n");
+			return 1;
+		}
+		printf("%-12s %8d %10.3f %12.0f %7.2fx %10ld %10ld %10ld %10.2f\n", "pool", thread_counts[run], seconds,
+			total.num_of_games / (seconds > 0 ? seconds : 1e-9),
+			serial_seconds * total.num_of_games / (seconds > 0 ? seconds : 1e-9), total.num_of_results[X_WINS],
+			total.num_of_results[O_WINS], total.num_of_results[DRAW], (double) total.num_of_plies / total.num_of_games);
+	}
+	return num_of_errors != 0;
+}
+#endif
+
+#if (BOARD_M == 3) && (BOARD_N == 3) && (BOARD_K == 3)
+/*
+ * Function:  corpus_prepare
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board, and empty the
+ * transposition and history tables so that every search starts afresh
+ * (without a time budget)
+ *
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	clear_board(&corpus_board);
+	for (cell = 0; cell < NUM_OF_CELLS; cell++){
+		if (position[cell] != '_'){
+			make_move(&corpus_board, cell, position[cell] == 'x');
+		}
+	}
+	clear_transposition_table();
+	clear_history_tables();
+	previous_value = 0;
+	time_budget = 0;
+	return 0;
+}
+
+/*
+ * Function:  corpus_choose
+ * --------------------
+ * Let computer_choose choose the move in corpus_board
+ *
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	num_of_nodes = 0;
+	computer_choose(&corpus_board, row_choice, col_choice);
+	return num_of_nodes;
+}
+#endif
+
+#ifdef USE_TERMINAL_STATUS_TABLE
+/*
+ * Function:  solve_position
+ * --------------------
+ * Solve a position and all the positions reachable from it, once each
+ * (memoized by the base-3 index). A position won by 'x' in n plies is worth
+ * WIN_VALUE - n, won by 'o' in n plies -(WIN_VALUE - n), and a draw 0
+ *
+ *  board: The board configuration
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *  values: Value of each index, ARBITRARILY_LOW_VALUE if not solved yet (input and output)
+ *  entries: solved_table entry of each index (output)
+ *
+ *  returns: The value of the position
+ */
+int solve_position(Bitboard *board, int is_maximizer, int *values, unsigned char *entries){
+	int move_id, cell, value, best_value, best_move;
+
+	if (values[board->index] != ARBITRARILY_LOW_VALUE){
+		return values[board->index];
+	}
+	switch (board->status){
+		case X_WINS: best_value = WIN_VALUE; break;
+		case O_WINS: best_value = -WIN_VALUE; break;
+		case DRAW: best_value = 0; break;
+		default: best_value = is_maximizer ? ARBITRARILY_LOW_VALUE : ARBITRARILY_HIGH_VALUE;
+	}
+	best_move = SOLVED_NO_MOVE;
+	for (move_id = 0; (board->status == ONGOING) && (move_id < NUM_OF_CELLS); move_id++){
+		cell = ordered_moves[move_id];
+		if (is_empty(board, cell) == 0){
+			continue;
+		}
+		make_move(board, cell, is_maximizer);
+		value = solve_position(board, 1 - is_maximizer, values, entries);
+		unmake_move(board, cell, is_maximizer);
+		/* One ply further from the end of the game */
+		if (value > 0){
+			value--;
+		} else if (value < 0){
+			value++;
+		}
+		if ((is_maximizer && (value > best_value)) || ((is_maximizer == 0) && (value < best_value))){
+			best_value = value;
+			best_move = cell;
+		}
+	}
+	values[board->index] = best_value;
+	if (best_value > 0){
+		entries[board->index] = (unsigned char) (X_WINS << 4 | best_move);
+	} else if (best_value < 0){
+		entries[board->index] = (unsigned char) (O_WINS << 4 | best_move);
+	} else {
+		entries[board->index] = (unsigned char) (DRAW << 4 | best_move);
+	}
+	return best_value;
+}
+
+/*
+ * Function:  print_solved_table
+ * --------------------
+ * Solve the game from the empty board and print solved_table.h
+ *
+ *  returns: 0
+ */
+int print_solved_table(void){
+	static int values[NUM_OF_INDICES];
+	static unsigned char entries[NUM_OF_INDICES];
+	Bitboard board;
+	int index, num_of_indices;
+
+	num_of_indices = 3*powers_of_three[NUM_OF_CELLS - 1];
+	for (index = 0; index < num_of_indices; index++){
+		values[index] = ARBITRARILY_LOW_VALUE;
+	}
+	clear_board(&board);
+	solve_position(&board, 1, values, entries);
+
+	printf("/*\n\tGenerated by ./tic-tac-toe solve for %dx%d with %d in a row, do not edit.\n", BOARD_M, BOARD_N, BOARD_K);
+	printf("\tOne entry per base-3 index: outcome << 4 | best move, 0 if unreachable\n*/\n\n");
+	printf("#if (BOARD_M != %d) || (BOARD_N != %d) || (BOARD_K != %d)\n", BOARD_M, BOARD_N, BOARD_K);
+	printf("#error \"solved_table.h was generated for another board\"\n#endif\n\n");
+	printf("static const unsigned char solved_table[%d] = {", num_of_indices);
+	for (index = 0; index < num_of_indices; index++){
+		printf("%s%s0x%02x", (index > 0) ? "," : "", (index % 16 == 0) ? "\n\t" : " ", entries[index]);
+	}
+	printf("\n};\n");
+	return 0;
+}
+#endif
+
+#ifdef USE_SOLVED_TABLE
+/*
+ * Function:  verify_solved_table
+ * --------------------
+ * Check every reachable position of solved_table against a live search: the
+ * outcome must match the sign of alpha_beta_routine, and the stored move
+ * must keep that outcome
+ *
+ *  returns: 0 if every entry agrees and 1 otherwise
+ */
+int verify_solved_table(void){
+	Bitboard board;
+	int index, cell, digits, is_maximizer;
+	int value, move_value, outcome, killer_move;
+	int num_of_positions = 0, num_of_errors = 0;
+
+	for (index = 0; index < 3*powers_of_three[NUM_OF_CELLS - 1]; index++){
+		if (solved_table[index] == 0){
+			continue;
+		}
+		clear_board(&board);
+		digits = index;
+		for (cell = 0; cell < NUM_OF_CELLS; cell++){
+			if (digits % 3 != 0){
+				make_move(&board, cell, digits % 3 == 1);
+			}
+			digits /= 3;
+		}
+		/* make_move only keeps the status of the last move */
+		board.status = terminal_status[board.index];
+		is_maximizer = (board.num_of_moves % 2 == 0);
+		num_of_positions++;
+
+		killer_move = NO_MOVE;
+		value = alpha_beta_routine(&board, 0, NUM_OF_CELLS, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE,
+			is_maximizer, &killer_move);
+		outcome = (value > 0) ? X_WINS : ((value < 0) ? O_WINS : DRAW);
+		move_value = value;
+		cell = SOLVED_MOVE(solved_table[index]);
+		if (cell != SOLVED_NO_MOVE){
+			make_move(&board, cell, is_maximizer);
+			killer_move = NO_MOVE;
+			move_value = alpha_beta_routine(&board, 1, NUM_OF_CELLS, ARBITRARILY_LOW_VALUE, ARBITRARILY_HIGH_VALUE,
+				1 - is_maximizer, &killer_move);
+			unmake_move(&board, cell, is_maximizer);
+		}
+		if ((SOLVED_OUTCOME(solved_table[index]) != outcome)
+			|| ((move_value > 0) != (value > 0)) || ((move_value < 0) != (value < 0))){
+			printf("Index %d: table says outcome %d with move %d, search says value %d (%d after the move)\n",
+				index, SOLVED_OUTCOME(solved_table[index]), cell, value, move_value);
+			num_of_errors++;
+		}
+	}
+	printf("%d positions checked, %d errors\n", num_of_positions, num_of_errors);
+	return num_of_errors > 0;
+}
+#endif
@@ -4,27 +4,144 @@
 	Also the computer always moves first ('X')	
 
 	The heuristic evaluation function is:
-		+) 1 when 'X' wins
-		+) -1 when 'O' wins
+		+) WIN_VALUE minus the number of plies when 'X' wins
+		+) -WIN_VALUE plus the number of plies when 'O' wins
 		+) 0 in case of a draw
 
+	Candidate moves are ordered with the heuristic function
+		123*c3 - 63*n2 + 31*c2 - 15*n1 + 7*c1
+	(see the 1-ply version), and then searched with alpha-beta pruning to
+	SEARCH_DEPTH plies (the end of the game). At every node more than one ply
+	from the horizon a 1-ply pass ranks the moves, best first for the player
+	to move, so that alpha-beta tries the likely refutations first. The
+	principal variation gives the computer's move, the reply it expects and
+	its own answer to that reply. The computer then ranks its moves for the
+	position after the expected reply, its expected answer first, and keeps
+	the list: if the player does play the expected reply, the next search
+	starts from that list without a new 1-ply pass.
+
+	All the boards of one 1-ply pass are scored with a single call to
+	heuristic_function_batch, which takes the boards in a structure-of-arrays
+	layout (an array of 'x' masks and an array of 'o' masks, cell (row, col)
+	being bit 3*row + col) and scores 8 boards per step with AVX2, 4 boards
+	per step with SSE2, or one at a time otherwise. It gives exactly the
+	same values as heuristic_function.
+
+	While the program waits for the player's move, a second thread ponders:
+	it searches the computer's answer to each reply of the player, the
+	expected reply first and then the others ranked by a 1-ply pass, and
+	fills the transposition table. The table is indexed by the base-3 index
+	of the board (cell (row, col) is digit 3*row + col, 0 for '_', 1 for 'x'
+	and 2 for 'o'), so there are no collisions, and it is kept from move to
+	move. The draft of an entry is counted to the end of the game rather
+	than from the root, so entries stored while searching earlier moves
+	still cut off. When the move arrives the thread is stopped and joined. If it had
+	finished the search of that reply (a ponder hit), the computer's search
+	is answered from the table in a handful of nodes; otherwise the search
+	still starts from whatever the thread stored.
+
 	Reference: 
 		[1] Computer Gamesmanship: The Complete Guide to Creating 
 		and Structuring intelligent game programs - David N.L.Levy
 
 	To compile with gcc, use:
-	gcc -ansi -pedantic -W -Wall -o tic-tac-toe  tic-tac-toe.c -pg
+	gcc -ansi -pedantic -W -Wall -pthread -o tic-tac-toe  tic-tac-toe.c -pg
+	(add -mavx2 to use the AVX2 kernel)
 	Then run:
 	./tic-tac-toe
+	To time the computer's move in a fixed corpus of positions (CORPUS_TRIALS
+	times each, or the number of trials given) and print, as CSV, the nodes,
+	the nodes per second, the median and 99th percentile time per move and
+	how often the move keeps the best outcome, run:
+	./tic-tac-toe corpus
+	To check heuristic_function_batch against heuristic_function on all 3^9 
+	boards and measure the boards scored per second, then play a game where
+	the player always makes the expected reply and compare the nodes of the
+	ordered search with those of alpha-beta in row-major order (without the
+	transposition table), then the nodes of the same moves after pondering,
+	run:
+	./tic-tac-toe bench
 */
 
+#define _POSIX_C_SOURCE 200112L	/* pthreads and clock_gettime under -ansi */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define ARBITRARILY_LOW_VALUE -10000
 #define ARBITRARILY_HIGH_VALUE 10000
+#define WIN_VALUE 1000
+#define SEARCH_DEPTH 9
+#define MAX_PLY 10
+#define WIN_THRESHOLD (WIN_VALUE - MAX_PLY)
+#define NUM_OF_INDICES 19683	/* 3^9 */
+#define NODES_BETWEEN_STOP_CHECKS 256
+
+/* Kinds of transposition table entry */
+#define NO_BOUND 0
+#define EXACT_BOUND 1
+#define LOWER_BOUND 2
+#define UPPER_BOUND 3
+
+typedef struct {
+	int value;	/* Relative to the position, see value_to_table */
+	signed char draft;	/* Number of plies searched below the position (see search_draft) */
+	char bound;
+	signed char best_cell;	/* 3*row + col, -1 if none */
+} TableEntry;
+
+/* Cells of the rows, columns and diagonals, as bit indices 3*row + col */
+static const int line_cells[8][3] = {
+	{0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+	{0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+	{0, 4, 8}, {2, 4, 6}
+};
+
+/* Number of positions visited by alpha_beta_routine */
+static long num_of_nodes = 0;
+
+#include "../corpus.h"
+
+/* Position loaded by corpus_prepare, and its number of moves */
+static char corpus_board[3][3];
+static int corpus_num_of_moves = 0;
+
+/* Set to 0 to search the moves in row-major order */
+static int use_ordering = 1;
+
+/* Principal variation from each ply, as cells 3*row + col */
+static int pv_cell[MAX_PLY][MAX_PLY];
+static int pv_length[MAX_PLY];
+static int pv_value;
+
+/* Set to 0 to search without the transposition table */
+static int use_transposition_table = 1;
+
+/* One entry per base-3 index, shared by the search and the ponder thread */
+static TableEntry transposition_table[NUM_OF_INDICES];
+
+/* Set when the ponder thread is asked to stop; the search then returns without storing */
+static int search_aborted = 0;
+
+static pthread_t ponder_thread;
+static pthread_mutex_t ponder_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int ponder_stop_requested = 0;
+static int is_pondering = 0;
+
+/* The board after the computer's move, and the expected reply (3*row + col, -1 if none) */
+static char ponder_board[3][3];
+static int ponder_predicted_cell = -1;
+
+/* Whether the ponder thread finished the search of each reply */
+static int ponder_done[9];
 
 int print_board(const char board[3][3]);
 
@@ -36,17 +153,62 @@ int is_draw(const char board[3][3]);
 
 int player_choose(const char board[3][3], int *row_choice, int *col_choice);
 
-int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choice);
+int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choice,
+	int player_last_row_choice, int player_last_col_choice);
+
+int search_root(char board[3][3], const int *move_row, const int *move_col, int num_of_moves,
+	int *row_choice, int *col_choice);
+
+int alpha_beta_routine(char board[3][3], int ply, int alpha, int beta, int is_maximizer);
+
+int search_draft(const char board[3][3], int ply);
+
+int generate_moves(char board[3][3], char player, int ply, int *move_row, int *move_col);
+
+int sort_moves(int *move_row, int *move_col, int *move_val, int num_of_moves, int is_maximizer);
+
+int prioritize_move(int cell, int *move_row, int *move_col, int num_of_moves);
+
+int board_index(const char board[3][3]);
+
+int value_to_table(int value, int ply);
+
+int value_from_table(int value, int ply);
+
+int clear_transposition_table(void);
+
+int pv_from_table(char board[3][3], int ply, int is_maximizer);
+
+int start_pondering(const char board[3][3]);
+
+int stop_pondering(int row_choice, int col_choice);
+
+void *ponder(void *arg);
+
+int ponder_should_stop(void);
 
 int heuristic_function(const char board[3][3]);
 
+int score_candidate_moves(char board[3][3], char player, int *move_row, int *move_col, int *move_val);
+
+int board_to_masks(const char board[3][3], unsigned int *x_mask, unsigned int *o_mask);
+
+int heuristic_function_batch(const unsigned int *x_masks, const unsigned int *o_masks, int *scores,
+	int num_of_boards);
+
+int run_benchmark(void);
+
+int run_search_benchmark(void);
+
+int run_ponder_benchmark(void);
+
 int num_of_three_rows(const char board[3][3], char player);
 
 int num_of_two_rows(const char board[3][3], char player);
 
 int num_of_one_rows(const char board[3][3], char player);
 
-int main()
+int main(int argc, char *argv[])
 {	
 	char board[3][3] =
     {
@@ -55,16 +217,23 @@ int main()
         { '_', '_', '_'}
     };
 	int is_maximizer = 1; /* The computer always moves first */
-	int row_choice, col_choice;		
+	int row_choice = -1, col_choice = -1;
 	int depth = 0;
 	srand(time(NULL));
 
+	if ((argc > 1) && (strcmp(argv[1], "bench") == 0)){
+		return run_benchmark();
+	}
+	if ((argc > 1) && (strcmp(argv[1], "corpus") == 0)){
+		return run_corpus_benchmark("short_lookahead", ((argc > 2) && (atoi(argv[2]) > 0)) ? atoi(argv[2]) : CORPUS_TRIALS);
+	}
+
 	while (1){
 		printf("\n\n");
 		print_board((const char (*)[3]) board);
 		if (is_maximizer == 1){						
 			printf("Computer's turn (x). Choose row and column: \n");
-			computer_choose(board, depth, &row_choice, &col_choice);
+			computer_choose(board, depth, &row_choice, &col_choice, row_choice, col_choice);
 			board[row_choice][col_choice] = 'x';			
 			if (is_victorious((const char (*)[3]) board, 'x')){
 				printf("\n\n");
@@ -81,7 +250,9 @@ int main()
 			is_maximizer = 0;
 			depth++;
 		} else {
+			start_pondering((const char (*)[3]) board);
 			player_choose((const char (*)[3]) board, &row_choice, &col_choice);
+			stop_pondering(row_choice, col_choice);
 			board[row_choice][col_choice] = 'o';			
 			if (is_victorious((const char (*)[3]) board, 'o')){
 				printf("\n\n");
@@ -236,22 +407,26 @@ int player_choose(const char board[3][3], int *row_choice, int *col_choice){
 /*
  * Function:  computer_choose 
  * --------------------
- * Run an AI routine to choose the best move for the computer 
+ * Run an AI routine to choose the best move for the computer. The moves are
+ * searched in the order kept from the previous move if the player made the
+ * expected reply, and in the order of a new 1-ply pass otherwise
  *    
  *  board: The board configuration   
+ *  depth: Number of moves made so far
  *  row_choice: Row index of the move (output)
  *  col_choice: Column index of the move (output)
+ *  player_last_row_choice: Row index of the player's last move, -1 if none
+ *  player_last_col_choice: Column index of the player's last move, -1 if none
  *
- *  returns: 0
+ *  returns: 1 if the kept ordering was used and 0 otherwise
  */
 int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choice,
 	int player_last_row_choice, int player_last_col_choice){
-	int i,j;	
-	int best_value;
-	int value;		
-	int enemy_best_choice_row = -1;
-	int enemy_best_choice_col = -1;
-	int enemy_best_choice_val = ARBITRARILY_HIGH_VALUE;
+	int i, j;
+	int move_row[9];
+	int move_col[9];
+	int num_of_moves;
+	int ordering_kept = 0;
 
 	static int ordered_move_row[9];
 	static int ordered_move_col[9];
@@ -259,65 +434,558 @@ int computer_choose(char board[3][3], int depth, int *row_choice, int *col_choic
 	static int num_of_ordered_moves = 0;
 	static int player_predicted_move_row = -1;
 	static int player_predicted_move_col = -1;
-	best_value = ARBITRARILY_LOW_VALUE;	
 
-	if (num_of_ordered_moves == 0){
-		/* Evaluate positions resulting from a 1-ply search*/
-		for (i = 0; i < 3; i++){
-			for (j = 0; j < 3; j++) {			
-				if (is_legal(board, i, j) == 0) {
-					continue;
-				}		
-				board[i][j] = 'x';		
-				value = heuristic_function((const char (*)[3]) board);
-				board[i][j] = '_';
-				if (best_value < value){
-					best_value = value;
-					*row_choice = i;
-					*col_choice = j;
-				}
+	(void) depth;
+	num_of_nodes = 0;
+	if ((num_of_ordered_moves > 0) && (player_last_row_choice == player_predicted_move_row)
+		&& (player_last_col_choice == player_predicted_move_col)){
+		/* The player made the expected reply: the kept list is already ordered for this board */
+		num_of_moves = 0;
+		for (i = 0; i < num_of_ordered_moves; i++){
+			if (is_legal((const char (*)[3]) board, ordered_move_row[i], ordered_move_col[i])){
+				move_row[num_of_moves] = ordered_move_row[i];
+				move_col[num_of_moves] = ordered_move_col[i];
+				num_of_moves++;
 			}
-		}			
+		}
+		ordering_kept = 1;
+	} else {
+		num_of_moves = generate_moves(board, 'x', 0, move_row, move_col);
+	}
+	search_root(board, move_row, move_col, num_of_moves, row_choice, col_choice);
+
+	/* Order our moves for the position after the expected reply, our expected answer first */
+	num_of_ordered_moves = 0;
+	player_predicted_move_row = -1;
+	player_predicted_move_col = -1;
+	if (pv_length[0] > 1){
+		player_predicted_move_row = pv_cell[0][1] / 3;
+		player_predicted_move_col = pv_cell[0][1] % 3;
 		board[*row_choice][*col_choice] = 'x';
-		/* Based on the best move found, find enemy's most possible move according to the heuristic */
-		for (i = 0; i < 3; i++){
-			for (j = 0; j < 3; j++) {			
-				if (is_legal(board, i, j) == 0) {
+		board[player_predicted_move_row][player_predicted_move_col] = 'o';
+		if ((is_victorious((const char (*)[3]) board, 'o') == 0) && (is_draw((const char (*)[3]) board) == 0)){
+			num_of_ordered_moves = score_candidate_moves(board, 'x', ordered_move_row, ordered_move_col,
+				ordered_move_val);
+			sort_moves(ordered_move_row, ordered_move_col, ordered_move_val, num_of_ordered_moves, 1);
+			for (i = 0; (pv_length[0] > 2) && (i < num_of_ordered_moves); i++){
+				if (3*ordered_move_row[i] + ordered_move_col[i] != pv_cell[0][2]){
 					continue;
-				}				
-				board[i][j] = 'o';	
-				value = heuristic_function((const char (*)[3]) board);
-				board[i][j] = '_';
-				if (enemy_best_choice_val > value){
-					enemy_best_choice_val = value;
-					enemy_best_choice_row = i;
-					enemy_best_choice_col = j;
 				}
+				for (j = i; j > 0; j--){
+					ordered_move_row[j] = ordered_move_row[j-1];
+					ordered_move_col[j] = ordered_move_col[j-1];
+					ordered_move_val[j] = ordered_move_val[j-1];
+				}
+				ordered_move_row[0] = pv_cell[0][2] / 3;
+				ordered_move_col[0] = pv_cell[0][2] % 3;
+				break;
 			}
-		}	
-		board[enemy_best_choice_row][enemy_best_choice_val] = 'o';
-		/* After the enemy has made his/her best move, we have to sort our own moves for the next search */
-		for (i = 0; i < 3; i++){
-			for (j = 0; j < 3; j++) {			
-				if (is_legal(board, i, j) == 0) {
-					continue;
-				}				
-				board[i][j] = 'o';	
-				value = heuristic_function((const char (*)[3]) board);
-				board[i][j] = '_';
-				if (enemy_best_choice_val > value){
-					enemy_best_choice_val = value;
-					enemy_best_choice_row = i;
-					enemy_best_choice_col = j;
+		}
+		board[player_predicted_move_row][player_predicted_move_col] = '_';
+		board[*row_choice][*col_choice] = '_';
+	}
+	return ordering_kept;
+}
+
+/*
+ * Function:  search_root 
+ * --------------------
+ * Search the computer's moves in the given order with alpha_beta_routine.
+ * The principal variation is left in pv_cell[0] and its value in pv_value.
+ * If the search is aborted, the result is meaningless
+ *    
+ *  board: The board configuration   
+ *  move_row: Row index of each move
+ *  move_col: Column index of each move
+ *  num_of_moves: Number of moves
+ *  row_choice: Row index of the best move (output)
+ *  col_choice: Column index of the best move (output)
+ *
+ *  returns: The value of the best move
+ */
+int search_root(char board[3][3], const int *move_row, const int *move_col, int num_of_moves,
+	int *row_choice, int *col_choice){
+	int i, k, value;
+	int best_value = ARBITRARILY_LOW_VALUE;
+
+	num_of_nodes++;
+	pv_length[0] = 0;
+	for (i = 0; i < num_of_moves; i++){
+		board[move_row[i]][move_col[i]] = 'x';
+		value = alpha_beta_routine(board, 1, best_value, ARBITRARILY_HIGH_VALUE, 0);
+		board[move_row[i]][move_col[i]] = '_';
+		if (search_aborted){
+			break;
+		}
+		if (value > best_value){
+			best_value = value;
+			*row_choice = move_row[i];
+			*col_choice = move_col[i];
+			pv_cell[0][0] = 3*move_row[i] + move_col[i];
+			for (k = 1; k < pv_length[1]; k++){
+				pv_cell[0][k] = pv_cell[1][k];
+			}
+			pv_length[0] = pv_length[1];
+		}
+	}
+	pv_value = best_value;
+	return best_value;
+}
+
+/*
+ * Function:  alpha_beta_routine 
+ * --------------------
+ * Alpha-beta search of the board, to SEARCH_DEPTH plies from the root
+ *    
+ *  board: The board configuration   
+ *  ply: Number of plies from the root
+ *  alpha: The best value the maximizer is assured of
+ *  beta: The best value the minimizer is assured of
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *
+ *  returns: The value of the board
+ */
+int alpha_beta_routine(char board[3][3], int ply, int alpha, int beta, int is_maximizer){
+	int i, k, value, best_value;
+	int move_row[9];
+	int move_col[9];
+	int num_of_moves;
+	int index = 0;
+	int best_cell = -1;
+	int original_alpha = alpha;
+	int original_beta = beta;
+	int draft = 0;
+	char bound;
+	TableEntry *entry;
+	char player = is_maximizer ? 'x' : 'o';
+
+	num_of_nodes++;
+	pv_length[ply] = ply;
+	if (((num_of_nodes % NODES_BETWEEN_STOP_CHECKS) == 0) && ponder_should_stop()){
+		search_aborted = 1;
+	}
+	if (search_aborted){
+		return 0;
+	}
+	if (is_victorious((const char (*)[3]) board, 'x')){
+		return WIN_VALUE - ply;
+	}
+	if (is_victorious((const char (*)[3]) board, 'o')){
+		return -(WIN_VALUE - ply);
+	}
+	if (is_draw((const char (*)[3]) board)){
+		return 0;
+	}
+	if (ply >= SEARCH_DEPTH){
+		return heuristic_function((const char (*)[3]) board);
+	}
+
+	entry = NULL;
+	if (use_transposition_table){
+		index = board_index((const char (*)[3]) board);
+		entry = &transposition_table[index];
+		draft = search_draft((const char (*)[3]) board, ply);
+		if ((entry->bound != NO_BOUND) && (entry->draft >= draft)){
+			value = value_from_table(entry->value, ply);
+			if ((entry->bound == EXACT_BOUND) || ((entry->bound == LOWER_BOUND) && (value >= beta))
+				|| ((entry->bound == UPPER_BOUND) && (value <= alpha))){
+				if (entry->bound == EXACT_BOUND){
+					pv_from_table(board, ply, is_maximizer);
 				}
+				return value;
 			}
-		}	
+		}
+	}
 
-		board[enemy_best_choice_row][enemy_best_choice_val] = '_';
-		board[*row_choice][*col_choice] = '_';
-	} else {
+	best_value = is_maximizer ? ARBITRARILY_LOW_VALUE : ARBITRARILY_HIGH_VALUE;
+	num_of_moves = generate_moves(board, player, ply, move_row, move_col);
+	/* The best move stored for this board goes first */
+	if ((entry != NULL) && (entry->bound != NO_BOUND)){
+		prioritize_move(entry->best_cell, move_row, move_col, num_of_moves);
+	}
+	for (i = 0; i < num_of_moves; i++){
+		board[move_row[i]][move_col[i]] = player;
+		value = alpha_beta_routine(board, ply + 1, alpha, beta, 1 - is_maximizer);
+		board[move_row[i]][move_col[i]] = '_';
+		if (search_aborted){
+			return 0;
+		}
+		if ((is_maximizer && (value > best_value)) || ((is_maximizer == 0) && (value < best_value))){
+			best_value = value;
+			best_cell = 3*move_row[i] + move_col[i];
+			pv_cell[ply][ply] = 3*move_row[i] + move_col[i];
+			for (k = ply + 1; k < pv_length[ply + 1]; k++){
+				pv_cell[ply][k] = pv_cell[ply + 1][k];
+			}
+			pv_length[ply] = pv_length[ply + 1];
+		}
+		if (is_maximizer){
+			if (best_value > alpha){
+				alpha = best_value;
+			}
+		} else {
+			if (best_value < beta){
+				beta = best_value;
+			}
+		}
+		if (alpha >= beta){
+			break;
+		}
+	}
+	if (entry != NULL){
+		if (best_value <= original_alpha){
+			bound = UPPER_BOUND;
+		} else if (best_value >= original_beta){
+			bound = LOWER_BOUND;
+		} else {
+			bound = EXACT_BOUND;
+		}
+		entry->value = value_to_table(best_value, ply);
+		entry->draft = (signed char) draft;
+		entry->bound = bound;
+		entry->best_cell = (signed char) best_cell;
+	}
+	return best_value;
+}
 
+/*
+ * Function:  search_draft 
+ * --------------------
+ * Number of plies alpha_beta_routine searches below a board: SEARCH_DEPTH 
+ * less the plies from the root, but never past the end of the game. As the
+ * search always reaches the end of the game, an entry stored by the search
+ * of an earlier move is as deep as one stored from the current root
+ *    
+ *  board: The board configuration   
+ *  ply: Number of plies from the root
+ *
+ *  returns: The number of plies
+ */
+int search_draft(const char board[3][3], int ply){
+	int cell, num_of_empty_cells = 0;
+	for (cell = 0; cell < 9; cell++){
+		if (board[cell / 3][cell % 3] == '_'){
+			num_of_empty_cells++;
+		}
+	}
+	return (SEARCH_DEPTH - ply < num_of_empty_cells) ? SEARCH_DEPTH - ply : num_of_empty_cells;
+}
+
+/*
+ * Function:  generate_moves 
+ * --------------------
+ * List the legal moves of a player. With use_ordering, and more than one ply
+ * from the horizon, the moves are ranked by a 1-ply pass, best first for the
+ * player; otherwise they are in row-major order
+ *    
+ *  board: The board configuration   
+ *  player: The player ('x' or 'o')
+ *  ply: Number of plies from the root
+ *  move_row: Row index of each move (output)
+ *  move_col: Column index of each move (output)
+ *
+ *  returns: The number of legal moves
+ */
+int generate_moves(char board[3][3], char player, int ply, int *move_row, int *move_col){
+	int i, j;
+	int move_val[9];
+	int num_of_moves = 0;
+
+	if (use_ordering && (ply < SEARCH_DEPTH - 1)){
+		num_of_moves = score_candidate_moves(board, player, move_row, move_col, move_val);
+		sort_moves(move_row, move_col, move_val, num_of_moves, player == 'x');
+		return num_of_moves;
+	}
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++){
+			if (is_legal((const char (*)[3]) board, i, j)){
+				move_row[num_of_moves] = i;
+				move_col[num_of_moves] = j;
+				num_of_moves++;
+			}
+		}
 	}
+	return num_of_moves;
+}
+
+/*
+ * Function:  sort_moves 
+ * --------------------
+ * Sort the moves by value, keeping the order of moves of equal value
+ *    
+ *  move_row: Row index of each move (input and output)
+ *  move_col: Column index of each move (input and output)
+ *  move_val: Heuristic value of each move (input and output)
+ *  num_of_moves: Number of moves
+ *  is_maximizer: 1 to put the highest value first, 0 for the lowest
+ *
+ *  returns: 0
+ */
+int sort_moves(int *move_row, int *move_col, int *move_val, int num_of_moves, int is_maximizer){
+	int i, j;
+	int row, col, val;
+	for (i = 1; i < num_of_moves; i++){
+		row = move_row[i];
+		col = move_col[i];
+		val = move_val[i];
+		for (j = i; (j > 0) && (is_maximizer ? (move_val[j-1] < val) : (move_val[j-1] > val)); j--){
+			move_row[j] = move_row[j-1];
+			move_col[j] = move_col[j-1];
+			move_val[j] = move_val[j-1];
+		}
+		move_row[j] = row;
+		move_col[j] = col;
+		move_val[j] = val;
+	}
+	return 0;
+}
+
+/*
+ * Function:  prioritize_move 
+ * --------------------
+ * Move a cell to the front of the move list, keeping the order of the others
+ *    
+ *  cell: The move, as 3*row + col (nothing happens if it is not in the list)
+ *  move_row: Row index of each move (input and output)
+ *  move_col: Column index of each move (input and output)
+ *  num_of_moves: Number of moves
+ *
+ *  returns: 0
+ */
+int prioritize_move(int cell, int *move_row, int *move_col, int num_of_moves){
+	int i, j;
+	for (i = 0; i < num_of_moves; i++){
+		if (3*move_row[i] + move_col[i] != cell){
+			continue;
+		}
+		for (j = i; j > 0; j--){
+			move_row[j] = move_row[j-1];
+			move_col[j] = move_col[j-1];
+		}
+		move_row[0] = cell / 3;
+		move_col[0] = cell % 3;
+		break;
+	}
+	return 0;
+}
+
+/*
+ * Function:  board_index 
+ * --------------------
+ * Compute the base-3 index of the board
+ *    
+ *  board: The board configuration   
+ *
+ *  returns: The sum of digit(cell) * 3^(3*row + col), the digit being 0 for
+ *  '_', 1 for 'x' and 2 for 'o'
+ */
+int board_index(const char board[3][3]){
+	int k;
+	int index = 0;
+	for (k = 8; k >= 0; k--){
+		index *= 3;
+		if (board[k / 3][k % 3] == 'x'){
+			index += 1;
+		} else if (board[k / 3][k % 3] == 'o'){
+			index += 2;
+		}
+	}
+	return index;
+}
+
+/*
+ * Function:  value_to_table 
+ * --------------------
+ * Make a win value relative to the position before storing it, so that it
+ * does not depend on how far the position is from the root
+ *    
+ *  value: The value, relative to the root
+ *  ply: Number of plies from the root
+ *
+ *  returns: The value to store
+ */
+int value_to_table(int value, int ply){
+	if (value > WIN_THRESHOLD){
+		return value + ply;
+	}
+	if (value < -WIN_THRESHOLD){
+		return value - ply;
+	}
+	return value;
+}
+
+/*
+ * Function:  value_from_table 
+ * --------------------
+ * Inverse of value_to_table
+ *    
+ *  value: The stored value
+ *  ply: Number of plies from the root
+ *
+ *  returns: The value, relative to the root
+ */
+int value_from_table(int value, int ply){
+	if (value > WIN_THRESHOLD){
+		return value - ply;
+	}
+	if (value < -WIN_THRESHOLD){
+		return value + ply;
+	}
+	return value;
+}
+
+/*
+ * Function:  clear_transposition_table 
+ * --------------------
+ * Remove every entry of the transposition table
+ *    
+ *  returns: 0
+ */
+int clear_transposition_table(void){
+	int index;
+	for (index = 0; index < NUM_OF_INDICES; index++){
+		transposition_table[index].bound = NO_BOUND;
+		transposition_table[index].best_cell = -1;
+	}
+	return 0;
+}
+
+/*
+ * Function:  pv_from_table 
+ * --------------------
+ * Rebuild the principal variation from a board answered by the table, by
+ * following the best moves of the exact entries
+ *    
+ *  board: The board configuration (restored before returning)
+ *  ply: Number of plies from the root
+ *  is_maximizer: Whether the player to move is the maximizer ('x')
+ *
+ *  returns: 0
+ */
+int pv_from_table(char board[3][3], int ply, int is_maximizer){
+	int k, cell;
+	const TableEntry *entry;
+
+	for (k = ply; k < MAX_PLY; k++){
+		entry = &transposition_table[board_index((const char (*)[3]) board)];
+		cell = entry->best_cell;
+		if ((entry->bound != EXACT_BOUND) || (cell < 0) || (is_legal((const char (*)[3]) board, cell / 3, cell % 3) == 0)){
+			break;
+		}
+		pv_cell[ply][k] = cell;
+		board[cell / 3][cell % 3] = is_maximizer ? 'x' : 'o';
+		is_maximizer = 1 - is_maximizer;
+	}
+	pv_length[ply] = k;
+	for (k--; k >= ply; k--){
+		board[pv_cell[ply][k] / 3][pv_cell[ply][k] % 3] = '_';
+	}
+	return 0;
+}
+
+/*
+ * Function:  start_pondering 
+ * --------------------
+ * Start the ponder thread on the board after the computer's move. The
+ * expected reply is taken from the principal variation of the last search
+ *    
+ *  board: The board configuration   
+ *
+ *  returns: 0 if the thread started and 1 otherwise
+ */
+int start_pondering(const char board[3][3]){
+	int cell;
+	memcpy(ponder_board, board, sizeof(ponder_board));
+	ponder_predicted_cell = (pv_length[0] > 1) ? pv_cell[0][1] : -1;
+	for (cell = 0; cell < 9; cell++){
+		ponder_done[cell] = 0;
+	}
+	ponder_stop_requested = 0;
+	if (pthread_create(&ponder_thread, NULL, ponder, NULL) != 0){
+		return 1;
+	}
+	is_pondering = 1;
+	return 0;
+}
+
+/*
+ * Function:  stop_pondering 
+ * --------------------
+ * Stop the ponder thread and wait for it
+ *    
+ *  row_choice: Row index of the player's move
+ *  col_choice: Column index of the player's move
+ *
+ *  returns: 1 if the thread finished the search of that move (a ponder hit) and 0 otherwise
+ */
+int stop_pondering(int row_choice, int col_choice){
+	if (is_pondering == 0){
+		return 0;
+	}
+	pthread_mutex_lock(&ponder_mutex);
+	ponder_stop_requested = 1;
+	pthread_mutex_unlock(&ponder_mutex);
+	pthread_join(ponder_thread, NULL);
+	is_pondering = 0;
+	search_aborted = 0;
+	return ponder_done[3*row_choice + col_choice];
+}
+
+/*
+ * Function:  ponder 
+ * --------------------
+ * Body of the ponder thread: search the computer's answer to each reply of
+ * the player, the expected reply first and then by a 1-ply ranking, until
+ * all are done or the thread is asked to stop
+ *    
+ *  arg: Unused
+ *
+ *  returns: NULL
+ */
+void *ponder(void *arg){
+	int i;
+	int reply_row[9];
+	int reply_col[9];
+	int reply_val[9];
+	int num_of_replies;
+	int move_row[9];
+	int move_col[9];
+	int num_of_moves;
+	int row_choice, col_choice;
+
+	(void) arg;
+	num_of_nodes = 0;
+	num_of_replies = score_candidate_moves(ponder_board, 'o', reply_row, reply_col, reply_val);
+	sort_moves(reply_row, reply_col, reply_val, num_of_replies, 0);
+	prioritize_move(ponder_predicted_cell, reply_row, reply_col, num_of_replies);
+	for (i = 0; (i < num_of_replies) && (search_aborted == 0); i++){
+		ponder_board[reply_row[i]][reply_col[i]] = 'o';
+		if ((is_victorious((const char (*)[3]) ponder_board, 'o') == 0)
+			&& (is_draw((const char (*)[3]) ponder_board) == 0)){
+			num_of_moves = generate_moves(ponder_board, 'x', 0, move_row, move_col);
+			search_root(ponder_board, move_row, move_col, num_of_moves, &row_choice, &col_choice);
+		}
+		ponder_board[reply_row[i]][reply_col[i]] = '_';
+		if (search_aborted == 0){
+			ponder_done[3*reply_row[i] + reply_col[i]] = 1;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Function:  ponder_should_stop 
+ * --------------------
+ * Check whether the ponder thread has been asked to stop
+ *    
+ *  returns: 1 if it has and 0 otherwise
+ */
+int ponder_should_stop(void){
+	int stop;
+	pthread_mutex_lock(&ponder_mutex);
+	stop = ponder_stop_requested;
+	pthread_mutex_unlock(&ponder_mutex);
+	return stop;
 }
 
 int heuristic_function(const char board[3][3]){
@@ -327,7 +995,402 @@ int heuristic_function(const char board[3][3]){
 	c2 = num_of_two_rows(board, 'x');
 	n1 = num_of_one_rows(board, 'o');
 	c1 = num_of_one_rows(board, 'x');
-	return c3 - n2 + c2 - n1 + c1;
+	return 123*c3 - 63*n2 + 31*c2 - 15*n1 + 7*c1;
+}
+
+/*
+ * Function:  score_candidate_moves 
+ * --------------------
+ * Score every legal move of a player with one call to heuristic_function_batch
+ *    
+ *  board: The board configuration   
+ *  player: The player ('x' or 'o')
+ *  move_row: Row index of each move (output)
+ *  move_col: Column index of each move (output)
+ *  move_val: Heuristic value of the board after each move (output)
+ *
+ *  returns: The number of legal moves
+ */
+int score_candidate_moves(char board[3][3], char player, int *move_row, int *move_col, int *move_val){
+	int i, j;
+	int num_of_moves = 0;
+	unsigned int x_mask, o_mask;
+	unsigned int x_masks[9];
+	unsigned int o_masks[9];
+
+	board_to_masks((const char (*)[3]) board, &x_mask, &o_mask);
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++) {			
+			if (is_legal((const char (*)[3]) board, i, j) == 0) {
+				continue;
+			}		
+			move_row[num_of_moves] = i;
+			move_col[num_of_moves] = j;
+			x_masks[num_of_moves] = x_mask;
+			o_masks[num_of_moves] = o_mask;
+			if (player == 'x'){
+				x_masks[num_of_moves] |= 1u << (3*i + j);
+			} else {
+				o_masks[num_of_moves] |= 1u << (3*i + j);
+			}
+			num_of_moves++;
+		}
+	}
+	heuristic_function_batch(x_masks, o_masks, move_val, num_of_moves);
+	return num_of_moves;
+}
+
+/*
+ * Function:  board_to_masks 
+ * --------------------
+ * Convert a board to the bit masks used by heuristic_function_batch
+ *    
+ *  board: The board configuration   
+ *  x_mask: Cells occupied by 'x', bit 3*row + col (output)
+ *  o_mask: Cells occupied by 'o', bit 3*row + col (output)
+ *
+ *  returns: 0
+ */
+int board_to_masks(const char board[3][3], unsigned int *x_mask, unsigned int *o_mask){
+	int i, j;
+	*x_mask = 0;
+	*o_mask = 0;
+	for (i = 0; i < 3; i++){
+		for (j = 0; j < 3; j++){
+			if (board[i][j] == 'x'){
+				*x_mask |= 1u << (3*i + j);
+			} else if (board[i][j] == 'o'){
+				*o_mask |= 1u << (3*i + j);
+			}
+		}
+	}
+	return 0;
+}
+
+/*
+ * Function:  heuristic_function_batch 
+ * --------------------
+ * Compute 123*c3 - 63*n2 + 31*c2 - 15*n1 + 7*c1 for many boards at once.
+ * For every line, with nx X's and no O's the line is worth 7, 31 or 123 
+ * (nx = 1, 2, 3), and with no = 1 or 2 O's and no X's it is worth -15 or -63
+ *    
+ *  x_masks: Cells occupied by 'x' on each board, bit 3*row + col
+ *  o_masks: Cells occupied by 'o' on each board, bit 3*row + col
+ *  scores: Heuristic value of each board (output)
+ *  num_of_boards: Number of boards
+ *
+ *  returns: 0
+ */
+int heuristic_function_batch(const unsigned int *x_masks, const unsigned int *o_masks, int *scores,
+	int num_of_boards){
+	static const int x_weight[4] = {0, 7, 31, 123};
+	static const int o_weight[4] = {0, -15, -63, 0};
+	int n = 0;
+	int line, k;
+	int num_of_x, num_of_o, score;
+#if defined(__AVX2__)
+	__m256i x, o, score_vec, num_x, num_o, line_x, line_o, zero;
+	__m256i has_x[9], has_o[9];
+	zero = _mm256_setzero_si256();
+	for (; n + 8 <= num_of_boards; n += 8){
+		x = _mm256_loadu_si256((const __m256i *) (x_masks + n));
+		o = _mm256_loadu_si256((const __m256i *) (o_masks + n));
+		/* -1 in the lanes where the cell is occupied */
+		for (k = 0; k < 9; k++){
+			has_x[k] = _mm256_cmpeq_epi32(_mm256_and_si256(x, _mm256_set1_epi32(1 << k)), _mm256_set1_epi32(1 << k));
+			has_o[k] = _mm256_cmpeq_epi32(_mm256_and_si256(o, _mm256_set1_epi32(1 << k)), _mm256_set1_epi32(1 << k));
+		}
+		score_vec = zero;
+		for (line = 0; line < 8; line++){
+			/* Minus the number of symbols on the line */
+			num_x = _mm256_add_epi32(_mm256_add_epi32(has_x[line_cells[line][0]], has_x[line_cells[line][1]]),
+				has_x[line_cells[line][2]]);
+			num_o = _mm256_add_epi32(_mm256_add_epi32(has_o[line_cells[line][0]], has_o[line_cells[line][1]]),
+				has_o[line_cells[line][2]]);
+			line_x = _mm256_or_si256(_mm256_or_si256(
+				_mm256_and_si256(_mm256_cmpeq_epi32(num_x, _mm256_set1_epi32(-1)), _mm256_set1_epi32(x_weight[1])),
+				_mm256_and_si256(_mm256_cmpeq_epi32(num_x, _mm256_set1_epi32(-2)), _mm256_set1_epi32(x_weight[2]))),
+				_mm256_and_si256(_mm256_cmpeq_epi32(num_x, _mm256_set1_epi32(-3)), _mm256_set1_epi32(x_weight[3])));
+			line_o = _mm256_or_si256(
+				_mm256_and_si256(_mm256_cmpeq_epi32(num_o, _mm256_set1_epi32(-1)), _mm256_set1_epi32(o_weight[1])),
+				_mm256_and_si256(_mm256_cmpeq_epi32(num_o, _mm256_set1_epi32(-2)), _mm256_set1_epi32(o_weight[2])));
+			score_vec = _mm256_add_epi32(score_vec, _mm256_and_si256(_mm256_cmpeq_epi32(num_o, zero), line_x));
+			score_vec = _mm256_add_epi32(score_vec, _mm256_and_si256(_mm256_cmpeq_epi32(num_x, zero), line_o));
+		}
+		_mm256_storeu_si256((__m256i *) (scores + n), score_vec);
+	}
+#elif defined(__SSE2__)
+	__m128i x, o, score_vec, num_x, num_o, line_x, line_o, zero;
+	__m128i has_x[9], has_o[9];
+	zero = _mm_setzero_si128();
+	for (; n + 4 <= num_of_boards; n += 4){
+		x = _mm_loadu_si128((const __m128i *) (x_masks + n));
+		o = _mm_loadu_si128((const __m128i *) (o_masks + n));
+		/* -1 in the lanes where the cell is occupied */
+		for (k = 0; k < 9; k++){
+			has_x[k] = _mm_cmpeq_epi32(_mm_and_si128(x, _mm_set1_epi32(1 << k)), _mm_set1_epi32(1 << k));
+			has_o[k] = _mm_cmpeq_epi32(_mm_and_si128(o, _mm_set1_epi32(1 << k)), _mm_set1_epi32(1 << k));
+		}
+		score_vec = zero;
+		for (line = 0; line < 8; line++){
+			/* Minus the number of symbols on the line */
+			num_x = _mm_add_epi32(_mm_add_epi32(has_x[line_cells[line][0]], has_x[line_cells[line][1]]),
+				has_x[line_cells[line][2]]);
+			num_o = _mm_add_epi32(_mm_add_epi32(has_o[line_cells[line][0]], has_o[line_cells[line][1]]),
+				has_o[line_cells[line][2]]);
+			line_x = _mm_or_si128(_mm_or_si128(
+				_mm_and_si128(_mm_cmpeq_epi32(num_x, _mm_set1_epi32(-1)), _mm_set1_epi32(x_weight[1])),
+				_mm_and_si128(_mm_cmpeq_epi32(num_x, _mm_set1_epi32(-2)), _mm_set1_epi32(x_weight[2]))),
+				_mm_and_si128(_mm_cmpeq_epi32(num_x, _mm_set1_epi32(-3)), _mm_set1_epi32(x_weight[3])));
+			line_o = _mm_or_si128(
+				_mm_and_si128(_mm_cmpeq_epi32(num_o, _mm_set1_epi32(-1)), _mm_set1_epi32(o_weight[1])),
+				_mm_and_si128(_mm_cmpeq_epi32(num_o, _mm_set1_epi32(-2)), _mm_set1_epi32(o_weight[2])));
+			score_vec = _mm_add_epi32(score_vec, _mm_and_si128(_mm_cmpeq_epi32(num_o, zero), line_x));
+			score_vec = _mm_add_epi32(score_vec, _mm_and_si128(_mm_cmpeq_epi32(num_x, zero), line_o));
+		}
+		_mm_storeu_si128((__m128i *) (scores + n), score_vec);
+	}
+#endif
+	/* The remaining boards */
+	for (; n < num_of_boards; n++){
+		score = 0;
+		for (line = 0; line < 8; line++){
+			num_of_x = 0;
+			num_of_o = 0;
+			for (k = 0; k < 3; k++){
+				num_of_x += (x_masks[n] >> line_cells[line][k]) & 1;
+				num_of_o += (o_masks[n] >> line_cells[line][k]) & 1;
+			}
+			if (num_of_o == 0){
+				score += x_weight[num_of_x];
+			}
+			if (num_of_x == 0){
+				score += o_weight[num_of_o];
+			}
+		}
+		scores[n] = score;
+	}
+	return 0;
+}
+
+/*
+ * Function:  run_benchmark 
+ * --------------------
+ * Check that heuristic_function_batch gives the same value as 
+ * heuristic_function on all 3^9 boards, then compare the number of boards
+ * scored per second (the char boards of heuristic_function are built once,
+ * outside the timed loop)
+ *    
+ *  returns: 0 if all the values agree and 1 otherwise
+ */
+int run_benchmark(void){
+	int num_of_boards = 19683;
+	int num_of_runs = 200;
+	char (*boards)[3][3];
+	unsigned int *x_masks;
+	unsigned int *o_masks;
+	int *scores;
+	int n, k, digits, run;
+	int num_of_mismatches = 0;
+	long checksum = 0;
+	clock_t tic;
+	double scalar_seconds, batch_seconds;
+
+	x_masks = (unsigned int *) malloc(num_of_boards * sizeof(unsigned int));
+	o_masks = (unsigned int *) malloc(num_of_boards * sizeof(unsigned int));
+	scores = (int *) malloc(num_of_boards * sizeof(int));
+	boards = (char (*)[3][3]) malloc(num_of_boards * sizeof(*boards));
+	if ((x_masks == NULL) || (o_masks == NULL) || (scores == NULL) || (boards == NULL)){
+		printf("Out of memory\n");
+		free(x_masks);
+		free(o_masks);
+		free(scores);
+		free(boards);
+		return 1;
+	}
+	/* Board n has digit (n / 3^k) % 3 in cell k: 0 for '_', 1 for 'x' and 2 for 'o' */
+	for (n = 0; n < num_of_boards; n++){
+		x_masks[n] = 0;
+		o_masks[n] = 0;
+		digits = n;
+		for (k = 0; k < 9; k++){
+			if (digits % 3 == 1){
+				x_masks[n] |= 1u << k;
+				boards[n][k / 3][k % 3] = 'x';
+			} else if (digits % 3 == 2){
+				o_masks[n] |= 1u << k;
+				boards[n][k / 3][k % 3] = 'o';
+			} else {
+				boards[n][k / 3][k % 3] = '_';
+			}
+			digits /= 3;
+		}
+	}
+
+	heuristic_function_batch(x_masks, o_masks, scores, num_of_boards);
+	tic = clock();
+	for (run = 0; run < num_of_runs; run++){
+		for (n = 0; n < num_of_boards; n++){
+			k = heuristic_function((const char (*)[3]) boards[n]);
+			checksum += k;
+			if ((run == 0) && (k != scores[n])){
+				num_of_mismatches++;
+			}
+		}
+	}
+	scalar_seconds = (double)(clock() - tic) / CLOCKS_PER_SEC;
+
+	tic = clock();
+	for (run = 0; run < num_of_runs; run++){
+		heuristic_function_batch(x_masks, o_masks, scores, num_of_boards);
+		checksum -= scores[run % num_of_boards];
+	}
+	batch_seconds = (double)(clock() - tic) / CLOCKS_PER_SEC;
+
+#if defined(__AVX2__)
+	printf("Kernel: AVX2\n");
+#elif defined(__SSE2__)
+	printf("Kernel: SSE2\n");
+#else
+	printf("Kernel: scalar\n");
+#endif
+	printf("Boards checked: %d, mismatches: %d (checksum %ld)\n", num_of_boards, num_of_mismatches, checksum);
+	printf("heuristic_function:       %12.0f boards/sec\n",
+		(double) num_of_boards * num_of_runs / (scalar_seconds > 0 ? scalar_seconds : 1e-9));
+	printf("heuristic_function_batch: %12.0f boards/sec\n",
+		(double) num_of_boards * num_of_runs / (batch_seconds > 0 ? batch_seconds : 1e-9));
+	free(x_masks);
+	free(o_masks);
+	free(scores);
+	free(boards);
+	return (num_of_mismatches != 0) | run_search_benchmark();
+}
+
+/*
+ * Function:  run_search_benchmark 
+ * --------------------
+ * Play a game where the player always makes the reply the computer expects.
+ * At each move of the computer, compare the nodes of computer_choose with
+ * those of alpha-beta on the moves in row-major order
+ *    
+ *  returns: 0 if both searches find the same value at every move and 1 otherwise
+ */
+int run_search_benchmark(void){
+	char board[3][3];
+	int move_row[9];
+	int move_col[9];
+	int num_of_moves;
+	int row_choice = -1, col_choice = -1;
+	int unordered_row = -1, unordered_col = -1;
+	int predicted_row, predicted_col;
+	int ordered_value, unordered_value, ordering_kept;
+	int depth;
+	long ordered_nodes, unordered_nodes;
+	long total_ordered_nodes = 0, total_unordered_nodes = 0;
+	int mismatch = 0;
+
+	/* Compare the orderings alone */
+	use_transposition_table = 0;
+	memset(board, '_', sizeof(board));
+	printf("\n%-6s %-6s %-8s %14s %14s %8s\n", "move", "choice", "ordering", "ordered nodes",
+		"row-major nodes", "value");
+	for (depth = 0; ; depth += 2){
+		ordering_kept = computer_choose(board, depth, &row_choice, &col_choice, row_choice, col_choice);
+		ordered_nodes = num_of_nodes;
+		ordered_value = pv_value;
+		predicted_row = (pv_length[0] > 1) ? pv_cell[0][1] / 3 : -1;
+		predicted_col = (pv_length[0] > 1) ? pv_cell[0][1] % 3 : -1;
+
+		use_ordering = 0;
+		num_of_nodes = 0;
+		num_of_moves = generate_moves(board, 'x', 0, move_row, move_col);
+		unordered_value = search_root(board, move_row, move_col, num_of_moves, &unordered_row, &unordered_col);
+		unordered_nodes = num_of_nodes;
+		use_ordering = 1;
+
+		printf("%-6d %d %-4d %-8s %14ld %14ld %8d\n", depth + 1, row_choice + 1, col_choice + 1,
+			ordering_kept ? "kept" : "1-ply", ordered_nodes, unordered_nodes, ordered_value);
+		if (ordered_value != unordered_value){
+			printf("MISMATCH: value %d in row-major order\n", unordered_value);
+			mismatch = 1;
+		}
+		total_ordered_nodes += ordered_nodes;
+		total_unordered_nodes += unordered_nodes;
+
+		board[row_choice][col_choice] = 'x';
+		if (is_victorious((const char (*)[3]) board, 'x') || is_draw((const char (*)[3]) board)
+			|| (predicted_row == -1)){
+			break;
+		}
+		board[predicted_row][predicted_col] = 'o';
+		if (is_victorious((const char (*)[3]) board, 'o') || is_draw((const char (*)[3]) board)){
+			break;
+		}
+		row_choice = predicted_row;
+		col_choice = predicted_col;
+	}
+	printf("Total: %ld nodes ordered, %ld in row-major order (%.2fx fewer)\n", total_ordered_nodes,
+		total_unordered_nodes, (double) total_unordered_nodes / total_ordered_nodes);
+	use_transposition_table = 1;
+	return mismatch | run_ponder_benchmark();
+}
+
+/*
+ * Function:  run_ponder_benchmark 
+ * --------------------
+ * Play the game of run_search_benchmark again with the transposition table,
+ * letting the ponder thread finish before each expected reply, and print
+ * the nodes of computer_choose after a ponder hit
+ *    
+ *  returns: 0 if every reply was a ponder hit with the same value and 1 otherwise
+ */
+int run_ponder_benchmark(void){
+	char board[3][3];
+	int row_choice = -1, col_choice = -1;
+	int predicted_row, predicted_col;
+	int depth, cell, num_of_done;
+	int ponder_hit = 1;
+	int mismatch = 0;
+
+	clear_transposition_table();
+	memset(board, '_', sizeof(board));
+	printf("\n%-6s %-6s %-10s %14s %8s\n", "move", "choice", "ponder hit", "nodes", "value");
+	for (depth = 0; ; depth += 2){
+		computer_choose(board, depth, &row_choice, &col_choice, row_choice, col_choice);
+		printf("%-6d %d %-4d %-10s %14ld %8d\n", depth + 1, row_choice + 1, col_choice + 1,
+			(depth == 0) ? "-" : (ponder_hit ? "yes" : "no"), num_of_nodes, pv_value);
+		if ((depth > 0) && (ponder_hit == 0)){
+			mismatch = 1;
+		}
+		if (pv_value != 0){
+			printf("MISMATCH: value %d, the game is a draw\n", pv_value);
+			mismatch = 1;
+		}
+		predicted_row = (pv_length[0] > 1) ? pv_cell[0][1] / 3 : -1;
+		predicted_col = (pv_length[0] > 1) ? pv_cell[0][1] % 3 : -1;
+		board[row_choice][col_choice] = 'x';
+		if (is_victorious((const char (*)[3]) board, 'x') || is_draw((const char (*)[3]) board)
+			|| (predicted_row == -1)){
+			break;
+		}
+		/* Let the thread search every reply before the player answers */
+		start_pondering((const char (*)[3]) board);
+		pthread_join(ponder_thread, NULL);
+		is_pondering = 0;
+		num_of_done = 0;
+		for (cell = 0; cell < 9; cell++){
+			num_of_done += ponder_done[cell];
+		}
+		printf("%-6s %-6s pondered %d replies in %ld nodes\n", "", "", num_of_done, num_of_nodes);
+		ponder_hit = ponder_done[3*predicted_row + predicted_col];
+		board[predicted_row][predicted_col] = 'o';
+		if (is_victorious((const char (*)[3]) board, 'o') || is_draw((const char (*)[3]) board)){
+			break;
+		}
+		row_choice = predicted_row;
+		col_choice = predicted_col;
+	}
+	return mismatch;
 }
 int num_of_three_rows(const char board[3][3], char player){
 	int i,j;
@@ -519,3 +1582,37 @@ int num_of_one_rows(const char board[3][3], char player){
 	return result;
 }
 
+/*
+ * Function:  corpus_prepare 
+ * --------------------
+ * Load a position of the corpus benchmark into corpus_board, count
+ * its moves and empty the transposition table
+ *    
+ *  position: The position, cells row by row, 'x' to move
+ *
+ *  returns: 0
+ */
+int corpus_prepare(const char *position){
+	int cell;
+	for (cell = 0; cell < 9; cell++){
+		corpus_board[cell / 3][cell % 3] = position[cell];
+	}
+	corpus_num_of_moves = corpus_depth(position);
+	clear_transposition_table();
+	return 0;
+}
+
+/*
+ * Function:  corpus_choose 
+ * --------------------
+ * Let the computer choose its move in corpus_board
+ *    
+ *  row_choice: The row chosen
+ *  col_choice: The column chosen
+ *
+ *  returns: The number of nodes searched
+ */
+long corpus_choose(int *row_choice, int *col_choice){
+	computer_choose(corpus_board, corpus_num_of_moves, row_choice, col_choice, -1, -1);
+	return num_of_nodes;
+}